@@ -204,11 +204,9 @@ def config_vecnav(portName):
     asyncDataOutputType = Registers.AsyncOutputType()
     # asyncDataOutputType.ador = Registers.AsyncOutputType.Ador.GPS
     asyncDataOutputType.serialPort = Registers.AsyncOutputType.SerialPort.Serial1
-    s.writeRegister(asyncDataOutputType)
     asyncDataOutputFreq= Registers.AsyncOutputFreq()
     asyncDataOutputFreq.adof = Registers.AsyncOutputFreq.Adof.Rate50Hz
     asyncDataOutputFreq.serialPort = Registers.AsyncOutputFreq.SerialPort.Serial1
-    s.writeRegister(asyncDataOutputFreq)
     
     #### CONFIGURE THE BINARY OUTPUT
     binaryOutput1Register = Registers.BinaryOutput1()
@@ -236,7 +234,9 @@ def config_vecnav(portName):
     binaryOutput1Register.gnss.gnss1PosUncertainty = 1
     binaryOutput1Register.gnss.gnss1Fix = 1
     binaryOutput1Register.gnss.gnss1NumSats = 1
-    s.writeRegister(binaryOutput1Register)
+
+    # Only registers which differ from the unit's are written, so a configured unit is left untouched
+    s.applyConfiguration([asyncDataOutputType, asyncDataOutputFreq, binaryOutput1Register], saveToFlash=False)
     s.disconnect()
 
 def sync_clock(portName, gps_timeout):
@@ -0,0 +1,173 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Measures ASCII measurement parsing on a stream of VNYMR, VNIMU and VNINS messages, either recorded from a unit or synthesized in the units' output
+// formats. Each numeric field is parsed both by fromString, which tries the fixed-format parser first, and by the general parser alone, which is what
+// fromString used before. The whole stream is then found and parsed into CompositeData as the ASCII dispatcher does.
+// Usage: AsciiParse [recordedStreamPath]
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include "Implementation/AsciiPacketProtocol.hpp"
+#include "Implementation/CoreUtils.hpp"
+#include "TemplateLibrary/String.hpp"
+
+using namespace VN;
+
+namespace
+{
+
+std::string frameMessage(const char* body)
+{
+    char checksum[8];
+    std::snprintf(checksum, sizeof(checksum), "*%04X\r\n", CalculateCRC(reinterpret_cast<const uint8_t*>(body), std::strlen(body)));
+    return std::string("$") + body + checksum;
+}
+
+std::string synthesizeStream(const size_t numEpochs)
+{
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<double> unit(-1, 1);
+    const auto u = [&]() { return unit(generator); };
+
+    std::string stream;
+    char body[300];
+    for (size_t i = 0; i < numEpochs; ++i)
+    {
+        std::snprintf(body, sizeof(body), "VNYMR,%+08.3f,%+08.3f,%+08.3f,%+07.4f,%+07.4f,%+07.4f,%+07.3f,%+07.3f,%+07.3f,%+09.6f,%+09.6f,%+09.6f", u() * 179,
+                      u() * 89, u() * 179, u(), u(), u(), u() * 9.8, u() * 9.8, u() * 9.8, u(), u(), u());
+        stream += frameMessage(body);
+        std::snprintf(body, sizeof(body), "VNIMU,%+07.4f,%+07.4f,%+07.4f,%+07.3f,%+07.3f,%+07.3f,%+09.6f,%+09.6f,%+09.6f,%+05.1f,%+06.2f", u(), u(), u(),
+                      u() * 9.8, u() * 9.8, u() * 9.8, u(), u(), u(), u() * 40, 100 + u());
+        stream += frameMessage(body);
+        std::snprintf(body, sizeof(body), "VNINS,%+012.6f,%04d,%04X,%+08.3f,%+08.3f,%+08.3f,%+012.8f,%+013.8f,%+09.3f,%+07.3f,%+07.3f,%+07.3f,%+06.1f,%+06.1f,%+06.2f",
+                      300000 + u() * 1000, 2300, 0x0207, u() * 179, u() * 89, u() * 179, 32 + u(), -117 + u(), 100 + u() * 10, u(), u(), u(),
+                      u() * 10 + 10, u() * 10 + 10, u() + 1);
+        stream += frameMessage(body);
+    }
+    return stream;
+}
+
+/// @brief The fields between each message's header and its checksum.
+std::vector<std::string> extractFields(const std::string& stream)
+{
+    std::vector<std::string> fields;
+    size_t messageBegin = stream.find('$');
+    while (messageBegin != std::string::npos)
+    {
+        const size_t messageEnd = stream.find('*', messageBegin);
+        if (messageEnd == std::string::npos) { break; }
+        size_t fieldBegin = stream.find(',', messageBegin);
+        while ((fieldBegin != std::string::npos) && (fieldBegin < messageEnd))
+        {
+            const size_t fieldEnd = std::min(stream.find(',', fieldBegin + 1), messageEnd);
+            fields.push_back(stream.substr(fieldBegin + 1, fieldEnd - fieldBegin - 1));
+            fieldBegin = fieldEnd;
+        }
+        messageBegin = stream.find('$', messageEnd);
+    }
+    return fields;
+}
+
+struct FieldTiming
+{
+    double nanosecondsPerField;
+    double sum;  // Of every value parsed, printed so that the parses cannot be optimized away
+};
+
+template <class T, typename Parse>
+FieldTiming measureNanosecondsPerField(const std::vector<std::string>& fields, const size_t numPasses, Parse parse)
+{
+    double sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t pass = 0; pass < numPasses; ++pass)
+    {
+        for (const auto& field : fields) { sum += static_cast<double>(parse(field.data(), field.data() + field.size()).value_or(T{})); }
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return FieldTiming{elapsed.count() / static_cast<double>(numPasses * fields.size()), sum};
+}
+
+template <class T>
+void compareFieldParsers(const char* typeName, const std::vector<std::string>& fields, const size_t numPasses)
+{
+    const FieldTiming general = measureNanosecondsPerField<T>(fields, numPasses, StringUtils::fromStringGeneral<T>);
+    const FieldTiming fromString = measureNanosecondsPerField<T>(fields, numPasses, StringUtils::fromString<T>);
+    std::printf("%-8s %14.1f ns/field %14.1f ns/field   sums %s (%g)\n", typeName, general.nanosecondsPerField, fromString.nanosecondsPerField,
+                (general.sum == fromString.sum) ? "match" : "DIFFER", fromString.sum);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string stream;
+    if (argc > 1)
+    {
+        std::ifstream recording(argv[1], std::ios::binary);
+        if (!recording) { return std::printf("Could not open %s\n", argv[1]), 1; }
+        stream.assign(std::istreambuf_iterator<char>(recording), std::istreambuf_iterator<char>());
+    }
+    else { stream = synthesizeStream(100); }
+
+    const std::vector<std::string> fields = extractFields(stream);
+    if (fields.empty()) { return std::printf("No ASCII messages in the stream\n"), 1; }
+    const size_t numPasses = std::max<size_t>(1, 20'000'000 / fields.size());
+    std::printf("%zu bytes, %zu fields\n", stream.size(), fields.size());
+    std::printf("%-8s %23s %23s\n", "type", "fromStringGeneral", "fromString");
+    compareFieldParsers<float>("float", fields, numPasses);
+    compareFieldParsers<double>("double", fields, numPasses);
+
+    ByteBuffer byteBuffer(stream.size());
+    byteBuffer.put(reinterpret_cast<const uint8_t*>(stream.data()), stream.size());
+    CompositeData compositeData;
+    size_t numPackets = 0;
+    size_t numFailed = 0;
+    const size_t numStreamPasses = std::max<size_t>(1, 200'000'000 / stream.size());
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t pass = 0; pass < numStreamPasses; ++pass)
+    {
+        size_t syncByteIndex = 0;
+        while (syncByteIndex < byteBuffer.size())
+        {
+            if (byteBuffer.peek_unchecked(syncByteIndex) != '$') { ++syncByteIndex; continue; }
+            const auto found = AsciiPacketProtocol::findPacket(byteBuffer, syncByteIndex);
+            if (found.validity != AsciiPacketProtocol::Validity::Valid) { ++syncByteIndex; continue; }
+            const auto measurementHeader = AsciiPacketProtocol::getMeasHeader(found.metadata.header);
+            numFailed += AsciiPacketProtocol::parsePacket(byteBuffer, syncByteIndex, found.metadata, measurementHeader, compositeData);
+            ++numPackets;
+            syncByteIndex += found.metadata.length;
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("find and parse: %.0f ns/packet, %.1f MB/s (%zu of %zu packets failed to parse)\n", elapsed.count() * 1e9 / static_cast<double>(numPackets),
+                static_cast<double>(stream.size() * numStreamPasses) / elapsed.count() / 1e6, numFailed, numPackets);
+    return 0;
+}
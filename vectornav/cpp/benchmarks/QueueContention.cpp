@@ -0,0 +1,112 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Measures the measurement queue under contention: the listener thread puts parsed measurements while several application threads take them. The
+// mutex-guarded DirectAccessQueue and the LockFreeDirectAccessQueue are compared with the same item type and capacity as MeasurementQueue.
+// Usage: QueueContention [numPuts]
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Config.hpp"
+#include "Interface/CompositeData.hpp"
+#include "TemplateLibrary/DirectAccessQueue.hpp"
+#include "TemplateLibrary/LockFreeDirectAccessQueue.hpp"
+
+using namespace VN;
+
+namespace
+{
+
+constexpr size_t queueCapacity = Config::PacketDispatchers::compositeDataQueueCapacity;
+
+struct Result
+{
+    double nanosecondsPerPut = 0;
+    size_t numReceived = 0;
+};
+
+/// @brief Puts numPuts measurements from this thread while numConsumers threads drain the queue.
+template <class Queue>
+Result measureContention(const size_t numConsumers, const size_t numPuts)
+{
+    auto queue = std::make_unique<Queue>();  // Too large for the stack
+    std::atomic<bool> isProducing{true};
+    std::atomic<size_t> numReceived{0};
+
+    std::vector<std::thread> consumers;
+    for (size_t i = 0; i < numConsumers; ++i)
+    {
+        consumers.emplace_back(
+            [&]()
+            {
+                size_t numGot = 0;
+                while (true)
+                {
+                    const bool wasProducing = isProducing.load();
+                    if (auto compositeData = queue->get()) { ++numGot; }
+                    else if (!wasProducing) { break; }
+                    else { std::this_thread::yield(); }
+                }
+                numReceived += numGot;
+            });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < numPuts; ++i)
+    {
+        if (auto compositeData = queue->put()) { compositeData->timestamp = time_point(Nanoseconds(i)); }
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    isProducing = false;
+    for (auto& consumer : consumers) { consumer.join(); }
+
+    return {elapsed.count() / static_cast<double>(numPuts), numReceived.load()};
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const size_t numPuts = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    // Puts never block: a full queue hands out its oldest element, so fewer than numPuts may be received.
+    std::printf("%u hardware threads, %zu puts of %zu-byte items into a queue of %zu\n", std::thread::hardware_concurrency(), numPuts,
+                sizeof(CompositeData), queueCapacity);
+    std::printf("%-10s %20s %20s\n", "consumers", "mutex (ns/put)", "lock-free (ns/put)");
+    for (const size_t numConsumers : {1, 2, 4, 8})
+    {
+        const Result mutexResult = measureContention<DirectAccessQueue<CompositeData, queueCapacity>>(numConsumers, numPuts);
+        const Result lockFreeResult = measureContention<LockFreeDirectAccessQueue<CompositeData, queueCapacity>>(numConsumers, numPuts);
+        std::printf("%-10zu %11.1f (%5.1f%%) %11.1f (%5.1f%%)\n", numConsumers, mutexResult.nanosecondsPerPut,
+                    100.0 * static_cast<double>(mutexResult.numReceived) / static_cast<double>(numPuts), lockFreeResult.nanosecondsPerPut,
+                    100.0 * static_cast<double>(lockFreeResult.numReceived) / static_cast<double>(numPuts));
+    }
+    return 0;
+}
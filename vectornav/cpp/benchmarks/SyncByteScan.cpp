@@ -0,0 +1,150 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Measures how fast PacketSynchronizer scans past bytes that no dispatcher accepts, as when noise or an unused ASCII stream fills the buffer. The
+// per-byte scan that dispatchNextPacket used before searching linear segments for sync bytes is reproduced here so both can be compared on the same
+// streams. Usage: SyncByteScan [megabytesPerStream]
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "Implementation/PacketSynchronizer.hpp"
+
+using namespace VN;
+
+namespace
+{
+
+/// @brief Rejects every sync byte it is offered, so every byte of the stream has to be scanned past.
+class NoiseDispatcher : public PacketDispatcher
+{
+public:
+    NoiseDispatcher(const uint8_t syncByte) : PacketDispatcher({syncByte}) {}
+
+    FindPacketRetVal findPacket([[maybe_unused]] const ByteBuffer& byteBuffer, [[maybe_unused]] const size_t syncByteIndex) noexcept override
+    {
+        return {FindPacketRetVal::Validity::Invalid, 0};
+    }
+
+    void dispatchPacket([[maybe_unused]] const ByteBuffer& byteBuffer, [[maybe_unused]] const size_t syncByteIndex) noexcept override {}
+};
+
+struct ScannedDispatcher
+{
+    PacketDispatcher* packetDispatcher = nullptr;
+    uint8_t syncByte = 0;
+    size_t numInvalidPackets = 0;
+};
+
+using ScannedDispatchers = Vector<ScannedDispatcher, PACKET_PARSER_CAPACITY>;
+
+/// @brief The previous scan: every index is compared against every dispatcher's sync byte through peek_unchecked.
+void perByteScan(ByteBuffer& byteBuffer, ScannedDispatchers& dispatchers)
+{
+    const size_t byteBufferSize = byteBuffer.size();
+    for (size_t fromHeadIndex = 0; fromHeadIndex < byteBufferSize; ++fromHeadIndex)
+    {
+        for (auto& dispatcher : dispatchers)
+        {
+            if (dispatcher.syncByte != byteBuffer.peek_unchecked(fromHeadIndex)) { continue; }
+            const auto retVal = dispatcher.packetDispatcher->findPacket(byteBuffer, fromHeadIndex);
+            if (retVal.validity == PacketDispatcher::FindPacketRetVal::Validity::Invalid) { ++dispatcher.numInvalidPackets; }
+        }
+    }
+    byteBuffer.discard(byteBufferSize);
+}
+
+/// @brief Pushes the stream through a ring in serial-sized reads, scanning after each read.
+/// @return Bytes scanned per second.
+template <typename Scan>
+double measureBytesPerSecond(const std::vector<uint8_t>& stream, const size_t numBytesToScan, Scan scan)
+{
+    // Reads that do not divide the ring keep moving where its storage wraps.
+    constexpr size_t readLength = Config::Serial::numBytesToReadPerGetData - 1;
+    size_t numBytesScanned = 0;
+    size_t streamOffset = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (numBytesScanned < numBytesToScan)
+    {
+        if (streamOffset + readLength > stream.size()) { streamOffset = 0; }
+        scan(stream.data() + streamOffset, readLength);
+        streamOffset += readLength;
+        numBytesScanned += readLength;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(numBytesScanned) / elapsed.count();
+}
+
+void compareScans(const char* streamName, const std::vector<uint8_t>& stream, const size_t numBytesToScan)
+{
+    std::array<NoiseDispatcher, 3> dispatchers{NoiseDispatcher(0xFA), NoiseDispatcher('$'), NoiseDispatcher(0xFB)};
+    ScannedDispatchers scannedDispatchers;
+    for (auto& dispatcher : dispatchers) { scannedDispatchers.push_back({&dispatcher, dispatcher.getSyncBytes().front()}); }
+
+    ByteBuffer perByteBuffer(Config::PacketFinders::mainBufferCapacity);
+    const double perByteRate = measureBytesPerSecond(stream, numBytesToScan,
+                                                     [&](const uint8_t* bytes, const size_t numBytes)
+                                                     {
+                                                         perByteBuffer.put(bytes, numBytes);
+                                                         perByteScan(perByteBuffer, scannedDispatchers);
+                                                     });
+
+    ByteBuffer synchronizedBuffer(Config::PacketFinders::mainBufferCapacity);
+    PacketSynchronizer packetSynchronizer(synchronizedBuffer);
+    for (auto& dispatcher : dispatchers) { packetSynchronizer.addDispatcher(&dispatcher); }
+    const double segmentRate = measureBytesPerSecond(stream, numBytesToScan,
+                                                     [&](const uint8_t* bytes, const size_t numBytes)
+                                                     {
+                                                         synchronizedBuffer.put(bytes, numBytes);
+                                                         while (!packetSynchronizer.dispatchNextPacket()) {}
+                                                     });
+
+    std::printf("%-24s %12.1f MB/s %12.1f MB/s %8.1fx\n", streamName, perByteRate / 1e6, segmentRate / 1e6, segmentRate / perByteRate);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const size_t numBytesToScan = ((argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 64) * 1000 * 1000;
+
+    std::mt19937 generator(1);
+    std::vector<uint8_t> randomStream(1 << 20);
+    for (auto& byte : randomStream) { byte = static_cast<uint8_t>(generator()); }
+
+    // An ASCII stream with its '$' stripped, as when a message type no dispatcher handles is being output.
+    const char* asciiMessage = "VNYMR,+012.345,-001.234,+000.567,+1.2345,-0.1234,+0.9876,-00.012,+00.034,-09.801,+0.001,-0.002,+0.003*5A\r\n";
+    std::vector<uint8_t> asciiStream(1 << 20);
+    for (size_t i = 0; i < asciiStream.size(); ++i) { asciiStream[i] = static_cast<uint8_t>(asciiMessage[i % std::strlen(asciiMessage)]); }
+
+    std::printf("%-24s %17s %17s %9s\n", "stream", "per byte", "per segment", "speedup");
+    compareScans("random bytes", randomStream, numBytesToScan);
+    compareScans("ASCII without '$'", asciiStream, numBytesToScan);
+    return 0;
+}
@@ -83,10 +83,13 @@ namespace PacketFinders
 constexpr uint64_t mainBufferCapacity = 4096;
 constexpr uint8_t maxNumPacketFinders = 3;                      // FA , Ascii and FB
 constexpr size_t skippedReceivedByteBufferMaxPutLength = 1000;  // bytes in a single loop
+constexpr uint8_t receivedTimeCapacity = 16;                     // Serial reads whose arrival times are remembered for stamping packets
+constexpr bool timestampAtLastByte = false;                      // Stamp packets with when their last byte arrived rather than their first
 
 // Fa
 constexpr uint16_t faPacketMaxLength = 2000;
 constexpr size_t satelliteMaxCount = SATELLITE_MAX_COUNT;  // Defiend in MeasurementDatatypes.hpp to avoid circular dependancy
+constexpr uint8_t faHeaderLayoutCacheCapacity = 4;          // Distinct binary output headers whose layouts are remembered
 
 // Ascii
 constexpr uint8_t asciiMaxFieldCount = 34;
@@ -105,18 +108,41 @@ namespace PacketDispatchers
 constexpr EnabledMeasurements cdEnabledMeasTypes = {
     TIME_GROUP_ENABLE, IMU_GROUP_ENABLE, GNSS_GROUP_ENABLE, ATTITUDE_GROUP_ENABLE, INS_GROUP_ENABLE, GNSS2_GROUP_ENABLE, 0, 0, 0, 0, 0, GNSS3_GROUP_ENABLE};
 constexpr uint8_t compositeDataQueueCapacity = 100;
+constexpr bool compactMeasurementQueue = false;  // Queue measurements as CompactCompositeData, holding only the fields present, rather than CompositeData
+constexpr uint8_t measurementCallbackCapacity = 5;  // Per sync byte
+constexpr uint16_t packetSubscriberQueueCapacity = 1000;  // Packets a subscriber's queue holds, as an exporter's does
+constexpr size_t packetArenaBlockOverhead = 32;           // Bytes a packet arena keeps alongside each packet
 
 // Fa
 constexpr uint8_t faPacketSubscriberCapacity = 5;
+constexpr uint8_t faSubscriberRouteCacheCapacity = 4;  // Distinct binary output headers whose subscriber routing is remembered
+// Room for a full subscriber queue of the longest FA or FB packets
+constexpr size_t faPacketArenaCapacity = packetSubscriberQueueCapacity * (PacketFinders::faPacketMaxLength + packetArenaBlockOverhead);
 
 // Ascii
 constexpr uint8_t asciiPacketSubscriberCapacity = 5;
+// Room for a full subscriber queue of the longest ASCII packets
+constexpr size_t asciiPacketArenaCapacity = packetSubscriberQueueCapacity * (PacketFinders::asciiPacketMaxLength + packetArenaBlockOverhead);
 }  // namespace PacketDispatchers
 
+namespace CompactCompositeData
+{
+constexpr bool variableLengthGnssEnabled =
+    ((GNSS_GROUP_ENABLE & (GNSS_GNSS1SATINFO_BIT | GNSS_GNSS1RAWMEAS_BIT)) | (GNSS2_GROUP_ENABLE & (GNSS2_GNSS2SATINFO_BIT | GNSS2_GNSS2RAWMEAS_BIT)) |
+     (GNSS3_GROUP_ENABLE & (GNSS3_GNSS3SATINFO_BIT | GNSS3_GNSS3RAWMEAS_BIT))) != 0;
+
+// Fields which do not fit are dropped, and the measurement is flagged as overflowed.
+constexpr uint16_t fixedFieldStorageCapacity = 256;      // Comfortably fits ~15 fixed size fields.
+constexpr uint16_t variableFieldStorageCapacity = 1024;  // e.g. GnssSatInfo with 50 satellites (402 bytes) and GnssRawMeas with 20 (572 bytes).
+constexpr uint16_t storageCapacity = fixedFieldStorageCapacity + (variableLengthGnssEnabled ? variableFieldStorageCapacity : 0);
+constexpr uint8_t fieldCapacity = 32;
+}  // namespace CompactCompositeData
+
 namespace Serial
 {
 constexpr uint64_t numBytesToReadPerGetData = 2000;
 constexpr size_t PortNameMaxLength = 15;
+constexpr bool interpolateReceivedTimes = true;  // Back-date each byte of a read by the time taken to transmit the bytes after it
 }  // namespace Serial
 
 namespace Sensor
@@ -124,23 +150,39 @@ namespace Sensor
 // Timers
 constexpr Microseconds commandSendTimeoutLength = 100ms;
 constexpr Microseconds wnvSendTimeoutLength = 1200ms;
-constexpr Microseconds getMeasurementTimeoutLength = 100ms;
+constexpr Microseconds getMeasurementTimeoutLength = 100ms;  // Default, can be set per call
+constexpr Microseconds listenWaitTimeoutLength = 100ms;
 
 // Sleeps
-constexpr Microseconds resetSleepDuration = 2500ms;
-constexpr Microseconds listenSleepDuration = 1ms;
-constexpr Microseconds getMeasurementSleepDuration = 100us;
+constexpr Microseconds resetSleepDuration = 2500ms;  // Upper bound on waiting for the unit to start up after a reset
+constexpr Microseconds listenSleepDuration = 1ms;  // Only used if the serial port does not support blocking waits
 constexpr Microseconds commandSendSleepDuration = 100us;
 
+// Polls
+constexpr Microseconds startupPollInitialInterval = 10ms;  // Doubles after each unanswered poll while waiting for the unit to start up
+constexpr Microseconds startupPollMaxInterval = 320ms;
+
 // Retries
 constexpr uint8_t commandSendRetriesAllowed = 2;
 constexpr bool retryVerifyConnectivity = true;
+
+// Auto connect
+constexpr Microseconds autoConnectListenDuration = 60ms;  // Per baud rate, listening for the unit's output before probing each rate in turn
+constexpr uint8_t autoConnectPortMemoryCapacity = 4;      // Ports whose last connected baud rate is tried first
+
+// Pipelining
+constexpr uint8_t maxCommandsInFlight = 4;  // Used by readRegisters and writeRegisters; leaves room in the command queue for other commands
+
+// Register cache
+constexpr uint8_t registerCacheCapacity = 16;  // Configuration registers whose values are remembered by writeRegisterIfChanged and applyConfiguration
 }  // namespace Sensor
 
 namespace CommandProcessor
 {
 constexpr uint8_t commandProcQueueCapacity = 10;
 constexpr size_t messageMaxLength = 280;
+constexpr Microseconds timeoutWheelTick = 1ms;       // Resolution of command timeouts
+constexpr uint16_t timeoutWheelSlotCount = 256;      // One revolution spans 256 ticks; longer timeouts take several
 }  // namespace CommandProcessor
 
 namespace Errors
@@ -154,6 +196,8 @@ static_assert(CommandProcessor::messageMaxLength >= PacketFinders::asciiPacketMa
 static_assert(PacketFinders::asciiPacketMaxLength > PacketFinders::asciiFieldMaxLength);
 static_assert(PacketFinders::asciiPacketMaxLength > PacketFinders::asciiHeaderMaxLength);
 static_assert(PacketFinders::mainBufferCapacity >= Serial::numBytesToReadPerGetData);
+static_assert(PacketFinders::fbPacketMaxLength <= PacketFinders::faPacketMaxLength);  // Reassembled FB packets are dispatched as FA packets
+static_assert((Sensor::maxCommandsInFlight > 0) && (Sensor::maxCommandsInFlight <= CommandProcessor::commandProcQueueCapacity));
 
 }  // namespace Config
 
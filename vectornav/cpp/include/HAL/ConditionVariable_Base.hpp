@@ -0,0 +1,57 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HAL_CONDITIONVARIABLE_BASE_HPP
+#define HAL_CONDITIONVARIABLE_BASE_HPP
+
+#include <cstdint>
+#include "HAL/Duration.hpp"
+
+namespace VN
+{
+
+/// @brief Lets threads sleep until another thread signals a change. Changes are counted by a generation number, so a waiter which reads the generation
+/// before checking its condition cannot miss a notification made between the check and the wait.
+class ConditionVariable_Base
+{
+public:
+    ConditionVariable_Base() {}
+
+    ConditionVariable_Base(const ConditionVariable_Base&) = delete;
+    ConditionVariable_Base& operator=(const ConditionVariable_Base&) = delete;
+
+    /// @brief The number of notifications so far, wrapping.
+    virtual uint32_t generation() const noexcept = 0;
+
+    /// @brief Advances the generation and wakes every waiting thread.
+    virtual void notifyAll() noexcept = 0;
+
+    /// @brief Blocks until the generation differs from the one passed, or the timeout elapses.
+    /// @return True if timed out.
+    virtual bool waitFor(const uint32_t generation, const Microseconds timeout) noexcept = 0;
+};
+
+}  // namespace VN
+
+#endif  // HAL_CONDITIONVARIABLE_BASE_HPP
@@ -0,0 +1,49 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HAL_CONDITIONVARIABLE_DISABLED_HPP
+#define HAL_CONDITIONVARIABLE_DISABLED_HPP
+
+#include "HAL/ConditionVariable_Base.hpp"
+
+namespace VN
+{
+class ConditionVariable : public ConditionVariable_Base
+{
+public:
+    ConditionVariable() {}
+
+    uint32_t generation() const noexcept override final { return _generation; }
+
+    void notifyAll() noexcept override final { ++_generation; }
+
+    // With a single thread, nothing can notify while we wait.
+    bool waitFor(const uint32_t generation, [[maybe_unused]] const Microseconds timeout) noexcept override final { return _generation == generation; }
+
+private:
+    uint32_t _generation = 0;
+};
+}  // namespace VN
+
+#endif  // HAL_CONDITIONVARIABLE_DISABLED_HPP
@@ -0,0 +1,73 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HAL_CONDITIONVARIABLE_PC_HPP
+#define HAL_CONDITIONVARIABLE_PC_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include "HAL/ConditionVariable_Base.hpp"
+
+namespace VN
+{
+class ConditionVariable : public ConditionVariable_Base
+{
+public:
+    ConditionVariable() {}
+
+    uint32_t generation() const noexcept override final { return _generation.load(); }
+
+    void notifyAll() noexcept override final
+    {
+        _generation.fetch_add(1);
+        if (_numWaiters.load() == 0) { return; }  // Notifying only costs the lock and wakeup if someone is waiting
+        {
+            // A waiter holds the lock from checking the generation until it is asleep, so taking it here ensures the wakeup is not missed.
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        _conditionVariable.notify_all();
+    }
+
+    bool waitFor(const uint32_t generation, const Microseconds timeout) noexcept override final
+    {
+        _numWaiters.fetch_add(1);
+        bool notified;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            notified = _conditionVariable.wait_for(lock, timeout, [&]() { return _generation.load() != generation; });
+        }
+        _numWaiters.fetch_sub(1);
+        return !notified;
+    }
+
+private:
+    std::atomic<uint32_t> _generation{0};
+    std::atomic<uint32_t> _numWaiters{0};
+    std::mutex _mutex;
+    std::condition_variable _conditionVariable;
+};
+}  // namespace VN
+
+#endif  // HAL_CONDITIONVARIABLE_PC_HPP
@@ -30,6 +30,7 @@
 #include "TemplateLibrary/ByteBuffer.hpp"
 #include "Interface/Command.hpp"
 #include "Config.hpp"
+#include "Implementation/ReceivedTimes.hpp"
 
 namespace VN
 {
@@ -80,9 +81,36 @@ public:
     /// @param message The message to send over the port.
     virtual Error send(const AsciiMessage& message) noexcept = 0;
 
+    // -------------------------------
+    /*! @name Port Events */
+    // -------------------------------
+
+    /// @brief Whether waitForData blocks on the port. If false, the caller is responsible for pacing calls to getData.
+    virtual bool supportsBlockingWait() const noexcept { return false; }
+
+    /// @brief Blocks until bytes are available to be read, the timeout elapses, or interruptWait is called.
+    /// @param timeout The maximum amount of time to block.
+    virtual Error waitForData([[maybe_unused]] const Microseconds timeout) noexcept { return Error::None; }
+
+    /// @brief Wakes any thread currently blocked in waitForData. Safe to call from any thread.
+    virtual void interruptWait() noexcept {}
+
+    /// @brief When the reads still held in the byte buffer arrived. Only to be read on the thread calling getData.
+    const ReceivedTimes& receivedTimes() const noexcept { return _receivedTimes; }
+
 protected:
+    /// @brief Stamps the numBytes just read into the byte buffer with receivedAt, the time the read returned.
+    void _recordReceivedTime(const size_t numBytes, const time_point receivedAt) noexcept
+    {
+        // Each byte takes 10 bits on the wire (start, 8 data, stop), so the last byte of the read arrived at receivedAt and each earlier one a byte time before.
+        const bool interpolate = Config::Serial::interpolateReceivedTimes && (_baudRate != 0);
+        const Nanoseconds byteDuration = interpolate ? Nanoseconds(10'000'000'000 / _baudRate) : Nanoseconds(0);
+        _receivedTimes.record(numBytes, receivedAt, byteDuration);
+    }
+
     ByteBuffer& _byteBuffer;
-    static const size_t _numBytesToReadPerGetData = Config::Serial::numBytesToReadPerGetData;
+    ReceivedTimes _receivedTimes{_byteBuffer};
+    static constexpr size_t _numBytesToReadPerGetData = Config::Serial::numBytesToReadPerGetData;
     bool _isOpen = false;
     PortName _portName;
     uint32_t _baudRate = 0;
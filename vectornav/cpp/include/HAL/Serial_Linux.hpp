@@ -31,22 +31,37 @@
 #include <cstring>
 #include <string>
 #include <optional>
+#include <algorithm>
 #include <sys/ioctl.h>  // Used for exclusive locking
 #include <termios.h>
 #include <linux/serial.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
 
 #include "HAL/Serial_Base.hpp"
 #include "Interface/Errors.hpp"
 #include "Serial_Base.hpp"
 
+// The termios2 BOTHER interface allows arbitrary integer baud rates. Its layout is only mirrored for architectures using the generic kernel termbits.
+#if (defined(__x86_64__) || defined(__i386__) || defined(__arm__) || defined(__aarch64__) || defined(__riscv))
+#define VN_SERIAL_TERMIOS2_ENABLE 1
+#else
+#define VN_SERIAL_TERMIOS2_ENABLE 0
+#endif
+
 namespace VN
 {
 
 class Serial : public Serial_Base
 {
 public:
-    using Serial_Base::Serial_Base;
+    Serial(ByteBuffer& byteBuffer) : Serial_Base(byteBuffer), _wakeHandle(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {};
+    ~Serial() override
+    {
+        if (_wakeHandle != -1) { ::close(_wakeHandle); }
+    };
 
     // ***********
     // Port access
@@ -62,19 +77,49 @@ public:
     Error getData() noexcept override final;
     Error send(const AsciiMessage& message) noexcept override final;
 
+    // ***********
+    // Port events
+    // ***********
+    bool supportsBlockingWait() const noexcept override final { return _wakeHandle != -1; }
+    Error waitForData(const Microseconds timeout) noexcept override final;
+    void interruptWait() noexcept override final;
+
 private:
     // ***********
     // Port access
     // ***********
     int _portHandle = 0;
-    bool _configurePort(const tcflag_t osBaudRate);
+    int _wakeHandle = -1;
+    Error _configurePort(const uint32_t baudRate);
 
     // ***************
     // Port read/write
     // ***************
     void _flush();
     static std::optional<tcflag_t> _getOsBaudRate(uint32_t baudRate);
-    std::array<uint8_t, _numBytesToReadPerGetData> _inputBuffer = {0};
+
+#if (VN_SERIAL_TERMIOS2_ENABLE)
+    // struct termios2 from <asm/termbits.h>, which conflicts with <termios.h> and so cannot be included directly.
+    struct KernelTermios2
+    {
+        tcflag_t c_iflag;
+        tcflag_t c_oflag;
+        tcflag_t c_cflag;
+        tcflag_t c_lflag;
+        cc_t c_line;
+        cc_t c_cc[19];
+        speed_t c_ispeed;
+        speed_t c_ospeed;
+    };
+    static constexpr unsigned long _getTermios2Request = _IOR('T', 0x2A, KernelTermios2);
+    static constexpr unsigned long _setTermios2Request = _IOW('T', 0x2B, KernelTermios2);
+    static constexpr tcflag_t _baudOther = 0010000;
+    static constexpr int _inputBaudShift = 16;
+    static constexpr uint32_t _baudRateTolerancePercent = 3;  // Typical UART receiver tolerance
+
+    Error _setCustomBaudRate(const uint32_t baudRate);
+    static bool _isWithinTolerance(const uint64_t actualBaudRate, const uint32_t baudRate);
+#endif
 };
 
 // ######################
@@ -105,9 +150,13 @@ inline Error Serial::open(const PortName& portName, const uint32_t baudRate) noe
 
     ioctl(_portHandle, TIOCEXCL);
 
-    auto osBaudRate = _getOsBaudRate(baudRate);
-    if (!osBaudRate.has_value()) { return Error::UnsupportedBaudRate; }
-    if (_configurePort(osBaudRate.value())) { return Error::UnexpectedSerialError; }
+    Error configureError = _configurePort(baudRate);
+    if (configureError != Error::None)
+    {
+        ioctl(_portHandle, TIOCNXCL);
+        ::close(_portHandle);
+        return configureError;
+    }
 
     _flush();
     _portName = portName;
@@ -125,8 +174,24 @@ inline void Serial::close() noexcept
 
 inline bool Serial::isSupportedBaudRate(const uint32_t baudRate) const noexcept
 {
-    auto osBaudRate = _getOsBaudRate(baudRate);
-    return osBaudRate.has_value();
+    if (_getOsBaudRate(baudRate).has_value()) { return true; }
+#if (VN_SERIAL_TERMIOS2_ENABLE)
+    // A nonstandard rate depends on the adapter, which can only be asked once the port is open.
+    if ((baudRate == 0) || !_isOpen) { return false; }
+
+    // Only read the driver's description of its clock, so that the live port is left untouched.
+    struct serial_struct serial;
+    if ((ioctl(_portHandle, TIOCGSERIAL, &serial) == -1) || (serial.baud_base <= 0))
+    {
+        // The driver does not describe its clock (as with many USB adapters), so the rate can only be checked by applying it, which changeBaudRate does.
+        return true;
+    }
+    const uint64_t baudBase = static_cast<uint64_t>(serial.baud_base);
+    const uint64_t divisor = std::max<uint64_t>(1, (baudBase + baudRate / 2) / baudRate);
+    return _isWithinTolerance(baudBase / divisor, baudRate);
+#else
+    return false;
+#endif
 }
 
 inline Error Serial::changeBaudRate(const uint32_t baudRate) noexcept
@@ -134,9 +199,8 @@ inline Error Serial::changeBaudRate(const uint32_t baudRate) noexcept
     if (!_isOpen) { return Error::SerialPortClosed; }
     _flush();
 
-    auto osBaudRate = _getOsBaudRate(baudRate);
-    if (!osBaudRate.has_value()) { return Error::UnsupportedBaudRate; }
-    if (_configurePort(osBaudRate.value())) { return Error::UnexpectedSerialError; }
+    Error configureError = _configurePort(baudRate);
+    if (configureError != Error::None) { return configureError; }
 
     _baudRate = baudRate;
     return Error::None;
@@ -146,14 +210,20 @@ inline Error Serial::getData() noexcept
 {
     if (!_isOpen) { return Error::SerialPortClosed; }
 
-    size_t numBytesAvailable = 0;
-    ioctl(_portHandle, FIONREAD, &numBytesAvailable);
-    if (numBytesAvailable == 0) { return Error::None; }
+    // Read straight into the free space of the byte buffer, which may wrap into two linear spans.
+    ByteBuffer::FreeSpans spans = _byteBuffer.reserve();
+    if (spans.size() == 0) { return Error::PrimaryBufferFull; }
+    const size_t firstSize = std::min<size_t>(spans.firstSize, _numBytesToReadPerGetData);
+    const size_t secondSize = std::min<size_t>(spans.secondSize, _numBytesToReadPerGetData - firstSize);
+    std::array<iovec, 2> iov{{{spans.first, firstSize}, {spans.second, secondSize}}};
 
-    ssize_t numBytesActuallyRead = ::read(_portHandle, &_inputBuffer[0], std::min(numBytesAvailable, _inputBuffer.size()));
-    if (numBytesActuallyRead == -1) { return Error::SerialReadFailed; }
+    // The port is configured with VMIN = VTIME = 0, so readv returns immediately with whatever is already available.
+    ssize_t numBytesActuallyRead = ::readv(_portHandle, iov.data(), (secondSize == 0) ? 1 : 2);
+    const time_point receivedAt = now();
+    if (numBytesActuallyRead == -1) { return (errno == EAGAIN || errno == EINTR) ? Error::None : Error::SerialReadFailed; }
 
-    if (_byteBuffer.put(&_inputBuffer[0], static_cast<size_t>(numBytesActuallyRead))) { return Error::PrimaryBufferFull; }
+    if (_byteBuffer.commit(static_cast<size_t>(numBytesActuallyRead))) { return Error::PrimaryBufferFull; }
+    _recordReceivedTime(static_cast<size_t>(numBytesActuallyRead), receivedAt);
     return Error::None;
 }
 
@@ -166,6 +236,29 @@ inline Error Serial::send(const AsciiMessage& message) noexcept
     return Error::None;
 }
 
+inline Error Serial::waitForData(const Microseconds timeout) noexcept
+{
+    if (!_isOpen) { return Error::SerialPortClosed; }
+
+    std::array<pollfd, 2> fds{{{_portHandle, POLLIN, 0}, {_wakeHandle, POLLIN, 0}}};
+    const int timeoutMs = static_cast<int>(std::chrono::ceil<Milliseconds>(timeout).count());
+    const int numReady = ::poll(fds.data(), fds.size(), timeoutMs);
+    if (numReady == -1) { return (errno == EINTR) ? Error::None : Error::SerialReadFailed; }
+
+    if (fds[1].revents & POLLIN)
+    {  // Drain the eventfd counter so the next wait blocks again.
+        eventfd_t count;
+        eventfd_read(_wakeHandle, &count);
+    }
+    if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) { return Error::SerialReadFailed; }
+    return Error::None;
+}
+
+inline void Serial::interruptWait() noexcept
+{
+    if (_wakeHandle != -1) { eventfd_write(_wakeHandle, 1); }
+}
+
 inline std::optional<tcflag_t> Serial::_getOsBaudRate(uint32_t baudRate)
 {
     tcflag_t baudRateFlag;
@@ -201,10 +294,20 @@ inline std::optional<tcflag_t> Serial::_getOsBaudRate(uint32_t baudRate)
     return std::make_optional(baudRateFlag);
 }
 
-inline bool Serial::_configurePort(const tcflag_t osBaudRate)
+inline Error Serial::_configurePort(const uint32_t baudRate)
 {
+    const auto osBaudRate = _getOsBaudRate(baudRate);
+#if (VN_SERIAL_TERMIOS2_ENABLE)
+    if (!osBaudRate.has_value() && baudRate == 0) { return Error::UnsupportedBaudRate; }
+    // Put back if the new rate cannot be applied, so the port is never left at a rate other than the one reported.
+    KernelTermios2 previousSettings;
+    if (ioctl(_portHandle, _getTermios2Request, &previousSettings) == -1) { return Error::UnexpectedSerialError; }
+#else
+    if (!osBaudRate.has_value()) { return Error::UnsupportedBaudRate; }
+#endif
+
     termios portSettings;
-    if (tcgetattr(_portHandle, &portSettings) == -1) { return true; }
+    if (tcgetattr(_portHandle, &portSettings) == -1) { return Error::UnexpectedSerialError; }
 
     portSettings.c_cflag |= (CLOCAL | CREAD);
     portSettings.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
@@ -212,9 +315,15 @@ inline bool Serial::_configurePort(const tcflag_t osBaudRate)
     portSettings.c_lflag &= ~(ICANON | ECHO | ECHOE | ECHOK | ECHONL | ISIG | IEXTEN);
     portSettings.c_cflag &= ~(CSIZE | PARENB);
     portSettings.c_cflag |= CS8;
+    portSettings.c_cc[VMIN] = 0;
+    portSettings.c_cc[VTIME] = 0;
 
-    cfsetispeed(&portSettings, osBaudRate);
-    cfsetospeed(&portSettings, osBaudRate);
+    // Nonstandard rates are set through termios2 once the rest of the settings have been applied, so until then the port keeps its current rate.
+    if (osBaudRate.has_value())
+    {
+        cfsetispeed(&portSettings, osBaudRate.value());
+        cfsetospeed(&portSettings, osBaudRate.value());
+    }
 
     // optimize serial port for low latency communication
     struct serial_struct serial;
@@ -222,10 +331,49 @@ inline bool Serial::_configurePort(const tcflag_t osBaudRate)
     serial.flags |= ASYNC_LOW_LATENCY;
     ioctl(_portHandle, TIOCSSERIAL, &serial);
 
-    tcsetattr(_portHandle, TCSANOW, &portSettings);
+    if (tcsetattr(_portHandle, TCSANOW, &portSettings) == -1)
+    {
+#if (VN_SERIAL_TERMIOS2_ENABLE)
+        ioctl(_portHandle, _setTermios2Request, &previousSettings);
+#endif
+        return Error::UnexpectedSerialError;
+    }
+
+#if (VN_SERIAL_TERMIOS2_ENABLE)
+    if (!osBaudRate.has_value())
+    {
+        const Error error = _setCustomBaudRate(baudRate);
+        if (error != Error::None) { ioctl(_portHandle, _setTermios2Request, &previousSettings); }
+        return error;
+    }
+#endif
+    return Error::None;
+}
 
-    return false;
+#if (VN_SERIAL_TERMIOS2_ENABLE)
+inline Error Serial::_setCustomBaudRate(const uint32_t baudRate)
+{
+    KernelTermios2 portSettings;
+    if (ioctl(_portHandle, _getTermios2Request, &portSettings) == -1) { return Error::UnsupportedBaudRate; }
+
+    portSettings.c_cflag &= ~(CBAUD | (CBAUD << _inputBaudShift));
+    portSettings.c_cflag |= _baudOther | (_baudOther << _inputBaudShift);
+    portSettings.c_ispeed = baudRate;
+    portSettings.c_ospeed = baudRate;
+    if (ioctl(_portHandle, _setTermios2Request, &portSettings) == -1) { return Error::UnsupportedBaudRate; }
+
+    // Drivers silently round to the nearest rate their clock divisor allows, so check what was actually applied.
+    if (ioctl(_portHandle, _getTermios2Request, &portSettings) == -1) { return Error::UnsupportedBaudRate; }
+    if (!_isWithinTolerance(portSettings.c_ospeed, baudRate)) { return Error::UnsupportedBaudRate; }
+    return Error::None;
+}
+
+inline bool Serial::_isWithinTolerance(const uint64_t actualBaudRate, const uint32_t baudRate)
+{
+    const uint64_t deviation = (actualBaudRate > baudRate) ? (actualBaudRate - baudRate) : (baudRate - actualBaudRate);
+    return deviation * 100 <= static_cast<uint64_t>(baudRate) * _baudRateTolerancePercent;
 }
+#endif
 
 inline void Serial::_flush()
 {
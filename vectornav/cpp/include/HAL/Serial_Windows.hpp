@@ -145,8 +145,10 @@ inline Error Serial::getData() noexcept
         VN_DEBUG_1("Error while reading from the serial port: " + std::to_string(GetLastError()));
         return Error::SerialReadFailed;
     }
+    const time_point receivedAt = now();
 
     if (_byteBuffer.put(_inputBuffer.data(), static_cast<size_t>(bytes_read))) { return Error::PrimaryBufferFull; }
+    _recordReceivedTime(static_cast<size_t>(bytes_read), receivedAt);
     return Error::None;
 }
 
@@ -25,11 +25,28 @@
 #ifndef HAL_THREAD_BASE_HPP
 #define HAL_THREAD_BASE_HPP
 
+#include <cstdint>
 #include "HAL/Duration.hpp"
+#include "Interface/Errors.hpp"
+#include "TemplateLibrary/String.hpp"
 
 namespace VN
 {
 
+struct ThreadAttributes
+{
+    enum class SchedulingPolicy : uint8_t
+    {
+        Default,     // Leaves the thread's scheduling unchanged
+        Fifo,        // Real-time, runs until it blocks or yields
+        RoundRobin,  // Real-time, time-sliced among threads of equal priority
+    };
+    SchedulingPolicy policy = SchedulingPolicy::Default;
+    int priority = 0;              // Only used by real-time policies. On Linux, 1 (lowest) to 99 (highest).
+    uint64_t cpuAffinityMask = 0;  // Bit n allows the thread to run on CPU n. Zero leaves the affinity unchanged.
+    String<15> name;               // Linux limits thread names to 15 characters. Empty leaves the name unchanged.
+};
+
 class Thread_Base
 {
 public:
@@ -43,6 +60,7 @@ public:
     virtual void join() = 0;
     virtual void detach() = 0;
     virtual bool joinable() const = 0;
+    virtual Error setAttributes(const ThreadAttributes& attributes) noexcept = 0;
 };
 namespace thisThread
 {
@@ -31,8 +31,13 @@
 #include "windows.h"
 #include "Debug.hpp"
 #endif
+#if (__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <cerrno>
+#include <algorithm>
+#endif
 #include "HAL/Thread_Base.hpp"
-// #include <Windows.h> // Necessary for priority
 
 namespace VN
 {
@@ -57,25 +62,55 @@ public:
 
     bool joinable() const override final { return _thread.joinable(); }
 
-    // void setHighestPriority() {
-    //     if (_thread.joinable()) {
-    //         std::cout << "joinable.\n";
-    //     } else {
-    //         std::cout << "Not joinable.\n";
-    //         // Should be exception?
-    //     }
-    //     // HANDLE threadHandle = static_cast<HANDLE>(_thread.native_handle());
-    //     // ThreadHandle_t threadHandle;
-    //     // HANDLE threadHandle = (HANDLE*)(_thread.native_handle());
-    //     auto threadHandle = _thread.native_handle();
-    //     // HANDLE myHandle = OpenThread(THREAD_ALL_ACCESS, true, threadHandle);
-    //     BOOL success = SetThreadPriority(threadHandle, THREAD_PRIORITY_HIGHEST);
-    //     //https://stackoverflow.com/questions/62751283/windowswhy-does-stdthreadnative-handle-return-a-value-of-type-long-long-u if (!success) {
-    //         DWORD lastError = GetLastError();
-    //         // 6 is ERROR_INVALID_HANDLE
-    //         throw(std::system_error(lastError, std::system_category(), "Error elevating thread priority"));
-    //     }
-    // }
+    /// @brief Applies each attribute that is set, carrying on past any that fail so that the rest still take effect. Returns the first failure.
+    /// Real-time policies need root or CAP_SYS_NICE, otherwise ThreadPermissionDenied is returned.
+    Error setAttributes(const ThreadAttributes& attributes) noexcept override final
+    {
+        if (!_thread.joinable()) { return Error::ThreadNotRunning; }
+#if (__linux__)
+        const auto toError = [](const int result)
+        {
+            switch (result)
+            {
+                case 0:
+                    return Error::None;
+                case EPERM:
+                    return Error::ThreadPermissionDenied;
+                default:
+                    return Error::InvalidThreadAttributes;
+            }
+        };
+        const pthread_t handle = _thread.native_handle();
+        Error firstError = Error::None;
+        const auto record = [&firstError](const Error error)
+        {
+            if (firstError == Error::None) { firstError = error; }
+        };
+        if (!attributes.name.empty()) { record(toError(pthread_setname_np(handle, attributes.name.c_str()))); }
+        if (attributes.cpuAffinityMask != 0)
+        {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            const size_t numCpus = std::min<size_t>(64, CPU_SETSIZE);  // The mask holds 64 CPUs
+            for (size_t cpu = 0; cpu < numCpus; ++cpu)
+            {
+                if ((attributes.cpuAffinityMask >> cpu) & 1) { CPU_SET(cpu, &cpuSet); }
+            }
+            record(toError(pthread_setaffinity_np(handle, sizeof(cpuSet), &cpuSet)));
+        }
+        if (attributes.policy != ThreadAttributes::SchedulingPolicy::Default)
+        {
+            sched_param param{};
+            param.sched_priority = attributes.priority;
+            const int policy = (attributes.policy == ThreadAttributes::SchedulingPolicy::Fifo) ? SCHED_FIFO : SCHED_RR;
+            record(toError(pthread_setschedparam(handle, policy, &param)));
+        }
+        return firstError;
+#else
+        const bool anySet = !attributes.name.empty() || (attributes.cpuAffinityMask != 0) || (attributes.policy != ThreadAttributes::SchedulingPolicy::Default);
+        return anySet ? Error::UnsupportedThreadAttributes : Error::None;
+#endif
+    }
 
 private:
     std::thread _thread;
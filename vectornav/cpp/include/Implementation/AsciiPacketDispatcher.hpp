@@ -25,15 +25,18 @@
 #ifndef IMPLEMENTATION_ASCIIPACKETDISPATCHER_HPP
 #define IMPLEMENTATION_ASCIIPACKETDISPATCHER_HPP
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <optional>
 
 #include "Implementation/PacketDispatcher.hpp"
+#include "Implementation/PacketArena.hpp"
 #include "Implementation/MeasurementDatatypes.hpp"
 #include "Implementation/CommandProcessor.hpp"
 #include "Implementation/AsciiPacketProtocol.hpp"
 #include "Implementation/QueueDefinitions.hpp"
+#include "HAL/Mutex.hpp"
 #include "Config.hpp"
 
 namespace VN
@@ -61,8 +64,15 @@ public:
     void removeSubscriber(PacketQueue_Interface* subscriberToRemove) noexcept;
     void removeSubscriber(PacketQueue_Interface* subscriberToRemove, const AsciiHeader& headerToUse) noexcept;
 
+    /// @brief Registers a callback to be invoked with every parsed measurement matching the filter, before it is published to the measurement queue.
+    bool addMeasurementCallback(MeasurementCallback callback, const AsciiHeader& headerToUse, SubscriberFilterType filterType) noexcept;
+
+    void removeMeasurementCallbacks() noexcept;
+    void removeMeasurementCallbacks(const AsciiHeader& headerToUse) noexcept;
+
 private:
     MeasurementQueue* _compositeDataQueue;
+    MeasurementParseBuffer _measurementParseBuffer;  // Only holds anything if the queue is compact
     [[maybe_unused]] EnabledMeasurements _enabledMeasurements;
 
     AsciiPacketProtocol::Metadata _latestPacketMetadata;
@@ -77,12 +87,27 @@ private:
     static const auto SUBSCRIBER_CAPACITY = Config::PacketDispatchers::asciiPacketSubscriberCapacity;
     using Subscribers = Vector<Subscriber, SUBSCRIBER_CAPACITY>;
     Subscribers _subscribers;
+    PacketArena _packetArena{Config::PacketDispatchers::asciiPacketArenaCapacity};
+
+    struct MeasurementCallbackEntry
+    {
+        MeasurementCallback callback;
+        AsciiHeader headerFilter;
+        SubscriberFilterType filterType;
+    };
+
+    using MeasurementCallbacks = Vector<MeasurementCallbackEntry, Config::PacketDispatchers::measurementCallbackCapacity>;
+    MeasurementCallbacks _measurementCallbacks;
+    std::atomic<bool> _hasMeasurementCallbacks = false;
+    Mutex _measurementCallbacksMutex;  // Callbacks are registered from the user's thread while the listening thread invokes them
 
+    static bool _matchesFilter(const AsciiHeader& filterHeader, const SubscriberFilterType filterType, const AsciiHeader& packetHeader) noexcept;
+    void _invokeMeasurementCallbacks(const AsciiHeader& packetHeader, const CompositeData& compositeData) noexcept;
     bool _tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
                                       AsciiPacketProtocol::AsciiMeasurementHeader measEnum) noexcept;
     void _invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata) noexcept;
     bool _tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
-                              Subscriber& subscriber) noexcept;
+                              Subscriber& subscriber, SharedPacketBuffer& sharedBuffer) noexcept;
 };
 }  // namespace VN
 
@@ -104,6 +104,11 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
 std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
                                          AsciiMeasurementHeader measEnum) noexcept;
 
+/// @brief Parses the packet directly into an existing object, such as a measurement queue slot.
+/// @return True if the packet could not be parsed, in which case the contents of compositeData are unspecified.
+bool parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, AsciiMeasurementHeader measEnum,
+                 CompositeData& compositeData) noexcept;
+
 }  // namespace AsciiPacketProtocol
 
 class AsciiPacketExtractor
@@ -114,8 +119,8 @@ public:
     {
     }
 
-    AsciiPacketExtractor(uint8_t* buffer, const AsciiPacketProtocol::Metadata& metadata)
-        : _buffer(buffer, metadata.length, metadata.length), _metadata(metadata)
+    AsciiPacketExtractor(const uint8_t* buffer, const AsciiPacketProtocol::Metadata& metadata)
+        : _buffer(ByteBuffer::readOnly(buffer, metadata.length)), _metadata(metadata)
     {
     }
 
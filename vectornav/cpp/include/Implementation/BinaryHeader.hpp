@@ -27,6 +27,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include "Implementation/BinaryMeasurementDefinitions.hpp"
 #include "Implementation/MeasurementDatatypes.hpp"
 #include "TemplateLibrary/Vector.hpp"
 #include "TemplateLibrary/String.hpp"  // Only used for AsciiHeader definition
@@ -87,6 +88,23 @@ private:
     unsigned int _countSetBits(uint8_t n);
 };
 
+/// @brief Whether a binary packet field, given by the group and field offsets of BinaryHeaderIterator, holds any of the passed measurements.
+inline bool holdsAnyMeasurement(const EnabledMeasurements& measurements, const uint8_t binaryGroup, const uint8_t binaryField) noexcept
+{
+    if (binaryGroup == 0)
+    {  // Common fields map to measurements in the other groups
+        if (binaryField >= CommonGroupMapping.size()) { return false; }
+        for (const auto& measurement : CommonGroupMapping[binaryField])
+        {
+            if (measurements[measurement.measGroupIndex - 1] & (1u << measurement.measTypeIndex)) { return true; }
+        }
+        return false;
+    }
+    // Subtracting 1 because of Common group offset
+    const size_t groupIndex = binaryGroup - 1;
+    return (groupIndex < measurements.size()) && (binaryField < 32) && (measurements[groupIndex] & (1u << binaryField));
+}
+
 class BinaryHeaderIterator
 {
 public:
@@ -25,12 +25,17 @@
 #ifndef IMPLEMENTATION_COMMANDPROCESSOR_HPP
 #define IMPLEMENTATION_COMMANDPROCESSOR_HPP
 
+#include <atomic>
 #include <functional>
 #include <memory>  // Used for shared_ptr
 #include <assert.h>
 #include "Config.hpp"
+#include "HAL/Mutex.hpp"
+#include "HAL/Timer.hpp"
 #include "TemplateLibrary/String.hpp"
 #include "TemplateLibrary/Queue.hpp"
+#include "TemplateLibrary/TimerWheel.hpp"
+#include "TemplateLibrary/Vector.hpp"
 #include "Implementation/CoreUtils.hpp"
 #include "Interface/Command.hpp"
 #include "Interface/Errors.hpp"
@@ -43,11 +48,19 @@ namespace VN
 /// (such as Serial and PacketProcessor). Consequently, it exists on multiple threads (all exists on the main thread except for matchReponse, which is called
 /// from the high-priority thread) with an internal queue to handle the cross-thread communication. Its chief responsibility is to facilitate the communication
 /// of commands between the user and the sensor, tracking received responses (sent via matchResponse) and correlating them with known-sent commands.
+/// Commands sent with sendCommandAsync are also timed out and resent here, driven by whichever thread calls serviceTimeouts, so no caller has to poll them.
 class CommandProcessor
 {
 public:
     using AsyncErrorQueuePush = std::function<void(AsyncError&&)>;
-    CommandProcessor(AsyncErrorQueuePush asyncErrorQueuePush) : _asyncErrorQueuePush(asyncErrorQueuePush) {}
+    using SerialSend = std::function<Error(const AsciiMessage&)>;
+    CommandProcessor(AsyncErrorQueuePush asyncErrorQueuePush, SerialSend serialSend = nullptr)
+        : _asyncErrorQueuePush(asyncErrorQueuePush), _serialSend(serialSend)
+    {
+    }
+
+    /// @brief Called once per command sent with sendCommandAsync, with the command's error response (or None) once answered, or ResponseTimeout.
+    using CommandCompletion = std::function<void(Command* command, Error error)>;
 
     struct RegisterCommandReturn
     {
@@ -63,14 +76,67 @@ public:
 
     bool matchResponse(const AsciiMessage& response, const AsciiPacketProtocol::Metadata& metadata) noexcept;
 
+    /// @brief Registers and sends the command under one lock, so commands reach the unit in the order they are queued. The command is not tracked further.
+    Error sendCommand(Command* pCommand) noexcept;
+
+    /// @brief Registers and sends the command, then tracks it until it is answered, resending it up to retriesAllowed times whenever timeout elapses first.
+    /// @param onComplete Called exactly once, from the thread calling matchResponse, serviceTimeouts or cancelCommand, unless this returns an error.
+    /// The command must outlive the call.
+    Error sendCommandAsync(Command* pCommand, CommandCompletion onComplete, const Microseconds timeout, const uint8_t retriesAllowed) noexcept;
+
+    /// @brief Stops tracking the command and removes it from the queue, completing it with ResponseTimeout.
+    /// @return True if the command was not being tracked.
+    bool cancelCommand(Command* pCommand) noexcept;
+
+    /// @brief Stops tracking every command, completing each with ResponseTimeout.
+    void cancelAllCommands() noexcept;
+
+    /// @brief Resends, or completes with ResponseTimeout, every tracked command whose timeout has elapsed.
+    void serviceTimeouts(const time_point currentTime) noexcept;
+
+    /// @brief The earliest time serviceTimeouts will have work to do, if any command is tracked.
+    std::optional<time_point> nextTimeout() const noexcept;
+
     int getQueueSize() const noexcept;
     void popCommandFromQueueBack() noexcept;
     std::optional<Command*> getFrontCommand() noexcept;
 
 private:
     AsyncErrorQueuePush _asyncErrorQueuePush = nullptr;
+    SerialSend _serialSend = nullptr;
 
     Queue_Mutexed<Command*, Config::CommandProcessor::commandProcQueueCapacity> _cmdQueue{};
+
+    struct TrackedCommand
+    {
+        Command* command = nullptr;
+        CommandCompletion onComplete;
+        Microseconds timeout{0};
+        uint8_t retriesRemaining = 0;
+    };
+
+    struct Completion
+    {
+        CommandCompletion onComplete;
+        Command* command;
+        Error error;
+    };
+
+    static constexpr uint16_t _trackedCapacity = Config::CommandProcessor::commandProcQueueCapacity;
+    using Completions = Vector<Completion, _trackedCapacity>;
+
+    std::array<TrackedCommand, _trackedCapacity> _trackedCommands{};
+    TimerWheel<_trackedCapacity, Config::CommandProcessor::timeoutWheelSlotCount> _timeouts{Config::CommandProcessor::timeoutWheelTick};
+    std::atomic<uint16_t> _numTracked = 0;
+    // Held while sending, matching and timing out, so a response is never matched against a command that was just cancelled or resent.
+    mutable Mutex _mutex;
+
+    Error _registerAndSend(Command* pCommand) noexcept;
+    bool _matchResponse(const AsciiMessage& response, const AsciiPacketProtocol::Metadata& metadata, Completions& completions) noexcept;
+    void _commandPopped(Command* pCommand, const bool matched, Completions& completions) noexcept;
+    std::optional<uint16_t> _findTracked(const Command* pCommand) const noexcept;
+    void _complete(const uint16_t id, const Error error, Completions& completions) noexcept;
+    static void _invoke(Completions& completions) noexcept;
 };
 
 }  // namespace VN
@@ -26,32 +26,91 @@
 #define CORE_COREUTILS_HPP
 
 #include <stdint.h>
+#include <array>
+#include <algorithm>
+#include "TemplateLibrary/ByteBuffer.hpp"
 
 namespace VN
 {
 
+// ------------------------------------------
+// Checksum
+// ------------------------------------------
+
 inline void _calculateCheckSum(uint8_t* checksum, uint8_t byte) noexcept { *checksum ^= byte; }
 
-inline uint8_t CalculateCheckSum(uint8_t* buffer, uint64_t bufferSize) noexcept
+inline uint8_t CalculateCheckSum(const uint8_t* buffer, uint64_t bufferSize, uint8_t checksum = 0) noexcept
 {
-    uint8_t checksum = 0;
     for (uint64_t i = 0; i < bufferSize; i++) { _calculateCheckSum(&checksum, buffer[i]); }
     return checksum;
 }
 
+/// @brief Calculates the checksum over numBytes of the ring buffer beginning at startIndex, which must already be in the buffer.
+inline uint8_t CalculateCheckSum(const ByteBuffer& buffer, const size_t startIndex, const size_t numBytes, uint8_t checksum = 0) noexcept
+{
+    const size_t numLinearBytes = std::min(buffer.numLinearBytes(startIndex), numBytes);
+    checksum = CalculateCheckSum(buffer.peek_pointer_unchecked(startIndex), numLinearBytes, checksum);
+    if (numBytes > numLinearBytes) { checksum = CalculateCheckSum(buffer.peek_pointer_unchecked(startIndex + numLinearBytes), numBytes - numLinearBytes, checksum); }
+    return checksum;
+}
+
+// ------------------------------------------
+// CRC16-CCITT (polynomial 0x1021, initial value 0)
+// ------------------------------------------
+
+namespace CrcTables
+{
+constexpr size_t numSlices = 8;
+using Tables = std::array<std::array<uint16_t, 256>, numSlices>;
+
+constexpr Tables generate() noexcept
+{
+    Tables tables{};
+    for (size_t byte = 0; byte < 256; ++byte)
+    {
+        uint16_t crc = static_cast<uint16_t>(byte << 8);
+        for (size_t bit = 0; bit < 8; ++bit) { crc = static_cast<uint16_t>((crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1)); }
+        tables[0][byte] = crc;
+    }
+    // Each further slice advances a table entry by one more zero byte, so that eight input bytes can be folded in at once.
+    for (size_t slice = 1; slice < numSlices; ++slice)
+    {
+        for (size_t byte = 0; byte < 256; ++byte)
+        {
+            const uint16_t previous = tables[slice - 1][byte];
+            tables[slice][byte] = static_cast<uint16_t>((previous << 8) ^ tables[0][previous >> 8]);
+        }
+    }
+    return tables;
+}
+
+inline constexpr Tables tables = generate();
+}  // namespace CrcTables
+
 inline void _calculateCRC(uint16_t* crc, uint8_t byte) noexcept
 {
-    *crc = static_cast<uint16_t>((*crc >> 8) | (*crc << 8));
-    *crc ^= byte;
-    *crc ^= ((*crc & 0xFF) >> 4);
-    *crc ^= ((*crc << 8) << 4);
-    *crc ^= (((*crc & 0xFF) << 4) << 1);
+    *crc = static_cast<uint16_t>((*crc << 8) ^ CrcTables::tables[0][static_cast<uint8_t>((*crc >> 8) ^ byte)]);
+}
+
+/// @brief Calculates the CRC over a contiguous span, eight bytes at a time. Pass a previous result as crc to continue a calculation.
+inline uint16_t CalculateCRC(const uint8_t* buffer, size_t bufferSize, uint16_t crc = 0) noexcept
+{
+    const auto& t = CrcTables::tables;
+    for (; bufferSize >= CrcTables::numSlices; bufferSize -= CrcTables::numSlices, buffer += CrcTables::numSlices)
+    {
+        crc = t[7][buffer[0] ^ (crc >> 8)] ^ t[6][buffer[1] ^ (crc & 0xFF)] ^ t[5][buffer[2]] ^ t[4][buffer[3]] ^ t[3][buffer[4]] ^ t[2][buffer[5]] ^
+              t[1][buffer[6]] ^ t[0][buffer[7]];
+    }
+    for (; bufferSize > 0; --bufferSize) { _calculateCRC(&crc, *buffer++); }
+    return crc;
 }
 
-inline uint16_t CalculateCRC(uint8_t* buffer, size_t bufferSize) noexcept
+/// @brief Calculates the CRC over numBytes of the ring buffer beginning at startIndex, which must already be in the buffer. Handles the wrap.
+inline uint16_t CalculateCRC(const ByteBuffer& buffer, const size_t startIndex, const size_t numBytes, uint16_t crc = 0) noexcept
 {
-    uint16_t crc = 0;
-    for (size_t i = 0; i < bufferSize; i++) { _calculateCRC(&crc, buffer[i]); }
+    const size_t numLinearBytes = std::min(buffer.numLinearBytes(startIndex), numBytes);
+    crc = CalculateCRC(buffer.peek_pointer_unchecked(startIndex), numLinearBytes, crc);
+    if (numBytes > numLinearBytes) { crc = CalculateCRC(buffer.peek_pointer_unchecked(startIndex + numLinearBytes), numBytes - numLinearBytes, crc); }
     return crc;
 }
 
@@ -25,6 +25,8 @@
 #ifndef IMPLEMENTATION_FAPACKETDISPATCHER_HPP
 #define IMPLEMENTATION_FAPACKETDISPATCHER_HPP
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <optional>
@@ -33,9 +35,11 @@
 #include "TemplateLibrary/ByteBuffer.hpp"
 #include "TemplateLibrary/Vector.hpp"
 #include "Implementation/PacketDispatcher.hpp"
+#include "Implementation/PacketArena.hpp"
 #include "Implementation/FaPacketProtocol.hpp"
 #include "Implementation/QueueDefinitions.hpp"
 #include "Implementation/BinaryHeader.hpp"
+#include "HAL/Mutex.hpp"
 #include "Config.hpp"
 
 namespace VN
@@ -45,12 +49,19 @@ class FaPacketDispatcher : public PacketDispatcher
 {
 public:
     FaPacketDispatcher(MeasurementQueue* measurementQueue, EnabledMeasurements enabledMeasurements)
-        : PacketDispatcher({0xFA}), _compositeDataQueue(measurementQueue), _enabledMeasurements(enabledMeasurements)
+        : PacketDispatcher({0xFA}),
+          _compositeDataQueue(measurementQueue),
+          _availableMeasurements(enabledMeasurements),
+          _enabledMeasurements(enabledMeasurements),
+          _requestedMeasurements(enabledMeasurements)
     {
     }
 
     PacketDispatcher::FindPacketRetVal findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
 
+    /// @brief Finds a packet which is stamped as having arrived at receivedAt, such as one reassembled from FB packets.
+    PacketDispatcher::FindPacketRetVal findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const time_point receivedAt) noexcept;
+
     void dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
 
     enum class SubscriberFilterType
@@ -65,6 +76,16 @@ public:
     void removeSubscriber(PacketQueue_Interface* subscriberToRemove) noexcept;
     void removeSubscriber(PacketQueue_Interface* subscriberToRemove, const EnabledMeasurements& headerToUse) noexcept;
 
+    /// @brief Registers a callback to be invoked with every parsed measurement matching the filter, before it is published to the measurement queue.
+    bool addMeasurementCallback(MeasurementCallback callback, EnabledMeasurements headerToUse, SubscriberFilterType filterType) noexcept;
+
+    void removeMeasurementCallbacks() noexcept;
+    void removeMeasurementCallbacks(const EnabledMeasurements& headerToUse) noexcept;
+
+    /// @brief Limits which measurements are parsed for the measurement queue and callbacks. Fields outside the mask are skipped without being decoded.
+    /// Can be called from any thread, and applies from the next packet. An empty mask parses every measurement the dispatcher was constructed with.
+    void setMeasurementsToParse(EnabledMeasurements measurementsToParse) noexcept;
+
 protected:
     struct Subscriber
     {
@@ -76,15 +97,60 @@ protected:
     static const auto SUBSCRIBER_CAPACITY = Config::PacketDispatchers::faPacketSubscriberCapacity;
     using Subscribers = Vector<Subscriber, SUBSCRIBER_CAPACITY>;
     Subscribers _subscribers;
+    std::atomic<uint32_t> _subscribersVersion = 1;  // Bumped whenever _subscribers changes, so that stale routes are rebuilt by the listening thread
+
+    /// @brief Where packets with one binary header go, worked out the first time that header is seen rather than for every packet.
+    struct SubscriberRoute
+    {
+        BinaryHeader header;
+        uint32_t headerHash = 0;
+        uint32_t subscribersVersion = 0;  ///< Zero while unused
+        EnabledMeasurements measurementHeader{};
+        Vector<PacketQueue_Interface*, SUBSCRIBER_CAPACITY> queues;
+    };
+
+    std::array<SubscriberRoute, Config::PacketDispatchers::faSubscriberRouteCacheCapacity> _subscriberRoutes{};
+    size_t _nextSubscriberRouteToReplace = 0;
+    PacketArena _packetArena{Config::PacketDispatchers::faPacketArenaCapacity};
+
+    struct MeasurementCallbackEntry
+    {
+        MeasurementCallback callback;
+        EnabledMeasurements headerFilter;
+        SubscriberFilterType filterType;
+    };
+
+    using MeasurementCallbacks = Vector<MeasurementCallbackEntry, Config::PacketDispatchers::measurementCallbackCapacity>;
+    MeasurementCallbacks _measurementCallbacks;
+    std::atomic<bool> _hasMeasurementCallbacks = false;
+    Mutex _measurementCallbacksMutex;  // Callbacks are registered from the user's thread while the listening thread invokes them
 
     MeasurementQueue* _compositeDataQueue;
-    EnabledMeasurements _enabledMeasurements;
+    MeasurementParseBuffer _measurementParseBuffer;  // Only holds anything if the queue is compact
+    const EnabledMeasurements _availableMeasurements;
+    EnabledMeasurements _enabledMeasurements;  // Only used by the listening thread, which copies in the requested measurements when they change
+    uint32_t _enabledMeasurementsVersion = 0;
+    EnabledMeasurements _requestedMeasurements;
+    std::atomic<uint32_t> _requestedMeasurementsVersion = 0;
+    Mutex _requestedMeasurementsMutex;
     FaPacketProtocol::Metadata _latestPacketMetadata;
-
-    bool _tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept;
-    void _invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept;
+    FaPacketProtocol::HeaderLayoutCache _headerLayoutCache;
+    const FaPacketProtocol::HeaderLayout* _latestPacketLayout = nullptr;
+
+    static bool _matchesFilter(const EnabledMeasurements& filterHeader, const SubscriberFilterType filterType, const EnabledMeasurements& packetHeader) noexcept;
+    void _applyRequestedMeasurements() noexcept;
+    bool _parseMeasurement(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                           CompositeData& compositeData) const noexcept;
+    void _invokeMeasurementCallbacks(const EnabledMeasurements& packetHeader, const CompositeData& compositeData) noexcept;
+    bool _tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                                      const EnabledMeasurements& packetHeader) noexcept;
+    static uint32_t _hashHeader(const BinaryHeader& header) noexcept;
+    const SubscriberRoute& _findSubscriberRoute(const BinaryHeader& header) noexcept;
+    void _routeSubscribers(SubscriberRoute& route, const uint32_t subscribersVersion) const noexcept;
+    void _invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                            const SubscriberRoute& route) noexcept;
     bool _tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
-                              Subscriber& subscriber) noexcept;
+                              PacketQueue_Interface* queueToPush, const SharedPacketBuffer& sharedBuffer) noexcept;
 };
 
 }  // namespace VN
@@ -25,6 +25,7 @@
 #ifndef IMPLEMENTATION_FAPACKETPROTOCOL_HPP
 #define IMPLEMENTATION_FAPACKETPROTOCOL_HPP
 
+#include <array>
 #include <optional>
 
 #include "Config.hpp"
@@ -50,17 +51,65 @@ struct Metadata
     bool operator==(const Metadata& other) const noexcept { return header == other.header && length == other.length; }
 };
 
+/// @brief The precomputed layout of every packet sharing a binary header.
+struct HeaderLayout
+{
+    struct Field
+    {
+        uint8_t group;
+        uint8_t field;
+        uint16_t offset;  ///< From the sync byte
+    };
+
+    Vector<uint8_t, binaryGroupMaxSize + binaryTypeMaxSize * 2> rawHeader;
+    BinaryHeader header;
+    bool hasDynamicLengthFields = false;  ///< SatInfo and RawMeas. If set, payloadLength and fields are not populated.
+    size_t payloadLength = 0;
+    Vector<Field, binaryTypeMaxSize * 15> fields;
+};
+
+/// @brief Remembers the layout of recently seen binary headers, keyed by the raw header bytes, so that packets with a known header need not be walked.
+class HeaderLayoutCache
+{
+public:
+    const HeaderLayout* find(const ByteBuffer& byteBuffer, const size_t syncByteIndex) const noexcept;
+    const HeaderLayout* insert(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const BinaryHeader& header) noexcept;
+    void reset() noexcept { _numEntries = 0; }
+
+private:
+    std::array<HeaderLayout, Config::PacketFinders::faHeaderLayoutCacheCapacity> _entries{};
+    size_t _numEntries = 0;
+    size_t _nextEntryToReplace = 0;
+};
+
 struct FindPacketReturn
 {
     Validity validity;
     Metadata metadata;
+    const HeaderLayout* layout = nullptr;  ///< Only set if a layout cache was passed. Valid until the next call with the same cache.
 };
 
-FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
+FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex, HeaderLayoutCache* layoutCache = nullptr) noexcept;
 
+/// @brief Parses the packet into a new CompositeData. Only the fields in measurementsToParse are decoded, the rest are skipped without being read; the
+/// packet is unparsable if none of its fields are wanted.
 std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
                                          const EnabledMeasurements& measurementsToParse) noexcept;
 
+/// @brief Parses the packet using the fields offsets of a cached layout, rather than walking the header.
+std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, const HeaderLayout& layout,
+                                         const EnabledMeasurements& measurementsToParse) noexcept;
+
+/// @brief Parses the packet directly into an existing object, such as a measurement queue slot. Only the fields held by its previous packet are reset.
+/// @return True if the packet could not be parsed, in which case the contents of compositeData are unspecified.
+bool parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, const EnabledMeasurements& measurementsToParse,
+                 CompositeData& compositeData) noexcept;
+
+/// @brief Parses the packet directly into an existing object using the field offsets of a cached layout.
+/// @return True if the packet could not be parsed, in which case the contents of compositeData are unspecified.
+bool parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, const HeaderLayout& layout,
+                 const EnabledMeasurements& measurementsToParse, CompositeData& compositeData) noexcept;
+
 }  // namespace FaPacketProtocol
 
 class FaPacketExtractor
@@ -69,7 +118,10 @@ public:
     // Passed buffer must contain bytes enough for metadata.length
     FaPacketExtractor(const ByteBuffer& buffer, const FaPacketProtocol::Metadata& metadata, size_t offset = 0) : _buffer(buffer, offset), _metadata(metadata) {}
 
-    FaPacketExtractor(uint8_t* buffer, const FaPacketProtocol::Metadata& metadata) : _buffer(buffer, metadata.length, metadata.length), _metadata(metadata) {}
+    FaPacketExtractor(const uint8_t* buffer, const FaPacketProtocol::Metadata& metadata)
+        : _buffer(ByteBuffer::readOnly(buffer, metadata.length)), _metadata(metadata)
+    {
+    }
 
     template <class T>
     T extract_unchecked() noexcept
@@ -92,6 +144,13 @@ public:
         return false;
     }
 
+    bool seek(const size_t index) noexcept
+    {
+        if (index > _metadata.length) { return true; }
+        _index = index;
+        return false;
+    }
+
     BinaryHeader header() const noexcept { return _metadata.header; };
     size_t length() const noexcept { return _metadata.length; };
 
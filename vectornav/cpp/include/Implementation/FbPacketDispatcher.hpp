@@ -60,6 +60,7 @@ private:
     ByteBuffer _fbByteBuffer;
     FbPacketProtocol::Metadata _latestPacketMetadata{};
     FbPacketProtocol::Metadata _previousPacketMetadata{};
+    time_point _firstFragmentReceivedTime;
 
     void _resetFbBuffer() noexcept;
     void _addFaPacketCrc() noexcept;
@@ -30,6 +30,7 @@
 
 #include "AsciiPacketProtocol.hpp"
 #include "FaPacketProtocol.hpp"
+#include "PacketArena.hpp"
 
 namespace VN
 {
@@ -52,10 +53,13 @@ struct PacketDetails
 
 struct Packet
 {
-    Packet(size_t length) : buffer(new uint8_t[length]), size(length) {}
+    /// @brief A packet without a buffer of its own, which can only hold bytes shared from a dispatcher's PacketArena.
+    Packet() : buffer(nullptr), _autoAllocated(false) {}
+
+    Packet(size_t length) : buffer(new uint8_t[length]), size(length), _ownBufferSize(length) {}
 
     template <size_t Capacity>
-    Packet(std::array<uint8_t, Capacity>& externalBuffer) : buffer(externalBuffer.data()), size(Capacity), _autoAllocated(false)
+    Packet(std::array<uint8_t, Capacity>& externalBuffer) : buffer(externalBuffer.data()), size(Capacity), _ownBufferSize(Capacity), _autoAllocated(false)
     {
     }
     ~Packet()
@@ -68,11 +72,35 @@ struct Packet
     Packet(Packet&&) = delete;
     Packet& operator=(Packet&&) = delete;
 
+    /// @brief Points the packet at bytes shared with every other subscriber to it, which are only readable through data.
+    void share(const SharedPacketBuffer& sharedBuffer) noexcept
+    {
+        _sharedBuffer = sharedBuffer;
+        size = _sharedBuffer.size();
+    }
+
+    /// @brief Lets go of any shared bytes and points the packet back at its own buffer.
+    /// @return The size of its own buffer, which is zero if it has none.
+    size_t useOwnBuffer() noexcept
+    {
+        _sharedBuffer.reset();
+        size = _ownBufferSize;
+        return size;
+    }
+
+    /// @brief The packet's bytes, whether shared or in its own buffer.
+    const uint8_t* data() const noexcept { return _sharedBuffer ? _sharedBuffer.data() : buffer; }
+
+    /// @brief Called by the queue holding the packet once it has been consumed, so that shared bytes go back to the arena straight away.
+    void onFreed() noexcept { useOwnBuffer(); }
+
     PacketDetails details{};
-    uint8_t* buffer;
-    size_t size = 0;
+    uint8_t* buffer;  // The packet's own buffer, if it has one. Never points at shared bytes, so read through data.
+    size_t size = 0;  // Of data
 
 private:
+    SharedPacketBuffer _sharedBuffer;
+    size_t _ownBufferSize = 0;
     const bool _autoAllocated = true;
 };
 
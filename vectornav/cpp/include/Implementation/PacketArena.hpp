@@ -0,0 +1,141 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef IMPLEMENTATION_PACKETARENA_HPP
+#define IMPLEMENTATION_PACKETARENA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "TemplateLibrary/ByteBuffer.hpp"
+#include "Config.hpp"
+
+namespace VN
+{
+
+class PacketArena;
+
+/// @brief A reference-counted handle to one packet's bytes in a PacketArena. Copies share the bytes, which go back to the arena once the last copy is
+/// released. The bytes cannot be changed once stored, so any number of threads may read them at once.
+class SharedPacketBuffer
+{
+public:
+    SharedPacketBuffer() = default;
+    ~SharedPacketBuffer() { reset(); }
+
+    SharedPacketBuffer(const SharedPacketBuffer& other) noexcept : _block(other._block)
+    {
+        if (_block) { _block->refCount.fetch_add(1, std::memory_order_relaxed); }
+    }
+
+    SharedPacketBuffer& operator=(const SharedPacketBuffer& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (other._block) { other._block->refCount.fetch_add(1, std::memory_order_relaxed); }
+            reset();
+            _block = other._block;
+        }
+        return *this;
+    }
+
+    SharedPacketBuffer(SharedPacketBuffer&& other) noexcept : _block(other._block) { other._block = nullptr; }
+
+    SharedPacketBuffer& operator=(SharedPacketBuffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            _block = other._block;
+            other._block = nullptr;
+        }
+        return *this;
+    }
+
+    const uint8_t* data() const noexcept { return _block ? reinterpret_cast<const uint8_t*>(_block + 1) : nullptr; }
+    size_t size() const noexcept { return _block ? _block->length : 0; }
+    explicit operator bool() const noexcept { return _block != nullptr; }
+
+    /// @brief Releases this handle's share of the bytes.
+    void reset() noexcept;
+
+private:
+    friend class PacketArena;
+
+    struct Storage;
+
+    // Every block in the arena, free or not, starts with one of these. The packet's bytes follow it.
+    struct BlockHeader
+    {
+        std::atomic<uint32_t> refCount;  // Zero if the block is free
+        uint32_t blockLength;            // Including this header, so that the next block can be found
+        uint32_t length;                 // Of the packet
+        Storage* storage;
+    };
+    static_assert(sizeof(BlockHeader) <= Config::PacketDispatchers::packetArenaBlockOverhead);
+
+    explicit SharedPacketBuffer(BlockHeader* block) noexcept : _block(block) {}
+
+    BlockHeader* _block = nullptr;
+};
+
+/// @brief The bytes of every packet a dispatcher hands to its subscribers, so that each packet is copied out of the main byte buffer once no matter how
+/// many subscribers receive it. Blocks are carved next-fit around a fixed ring, so a packet held onto for a long time only ties up its own bytes.
+/// Only one thread may store packets. Handles may be released from any thread, and may outlive the arena.
+class PacketArena
+{
+public:
+    /// @param capacity The number of bytes shared among every packet held by a subscriber. Zero disables the arena. They are allocated once the first
+    /// packet is stored.
+    explicit PacketArena(const size_t capacity);
+    ~PacketArena();
+
+    PacketArena(const PacketArena&) = delete;
+    PacketArena& operator=(const PacketArena&) = delete;
+    PacketArena(PacketArena&&) = delete;
+    PacketArena& operator=(PacketArena&&) = delete;
+
+    /// @brief Copies a packet out of the byte buffer into the arena.
+    /// @return A handle to the stored bytes, or an empty handle if subscribers are holding on to too much of the arena for the packet to fit.
+    SharedPacketBuffer store(const ByteBuffer& byteBuffer, const size_t startIndex, const size_t length) noexcept;
+
+    size_t capacity() const noexcept { return _capacity; }
+
+private:
+    using BlockHeader = SharedPacketBuffer::BlockHeader;
+    using Storage = SharedPacketBuffer::Storage;
+
+    Storage* _storage = nullptr;
+    size_t _capacity = 0;
+    size_t _nextBlockIndex = 0;  // Where the search for room for the next packet starts
+
+    BlockHeader* _blockAt(const size_t index) const noexcept;
+    void _setFreeBlock(const size_t index, const size_t blockLength) noexcept;
+};
+
+}  // namespace VN
+
+#endif  // IMPLEMENTATION_PACKETARENA_HPP
@@ -26,8 +26,12 @@
 #define IMPLEMENTATION_PACKETDISPATCHER_HPP
 
 #include <cstdint>
+#include <functional>
+#include "HAL/Timer.hpp"
 #include "TemplateLibrary/ByteBuffer.hpp"
 #include "TemplateLibrary/Vector.hpp"
+#include "Implementation/ReceivedTimes.hpp"
+#include "Interface/CompositeData.hpp"
 #include "Config.hpp"
 
 namespace VN
@@ -35,6 +39,9 @@ namespace VN
 
 constexpr uint8_t SYNC_BYTE_CAPACITY = 1;
 
+/// @brief Invoked on the thread dispatching packets with each freshly parsed measurement. The reference is only valid for the duration of the call.
+using MeasurementCallback = std::function<void(const CompositeData&)>;
+
 class PacketDispatcher
 {
 public:
@@ -57,7 +64,20 @@ public:
 
     virtual void dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept = 0;
 
+    /// @brief Stamps packets found in the buffer that receivedTimes belongs to with when they arrived. Packets found in any other buffer are stamped when found.
+    void setReceivedTimes(const ReceivedTimes* const receivedTimes) noexcept { _receivedTimes = receivedTimes; }
+
+protected:
+    /// @brief When the packet at syncByteIndex arrived, by its first byte or, if timestampAtLastByte, its last. Falls back to now if the arrival was not recorded.
+    time_point _packetReceivedTime(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const size_t packetLength) const noexcept
+    {
+        if ((_receivedTimes == nullptr) || !_receivedTimes->isOf(byteBuffer)) { return now(); }
+        const size_t index = Config::PacketFinders::timestampAtLastByte ? (syncByteIndex + packetLength - 1) : syncByteIndex;
+        return _receivedTimes->at(index).value_or(now());
+    }
+
 private:
+    const ReceivedTimes* _receivedTimes = nullptr;
     Vector<uint8_t, SYNC_BYTE_CAPACITY> _syncBytes{};
 };
 }  // namespace VN
@@ -25,9 +25,11 @@
 #ifndef IMPLEMENTATION_PACKETSYNCHRONIZER_HPP
 #define IMPLEMENTATION_PACKETSYNCHRONIZER_HPP
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <algorithm>
+#include <array>
 #include "TemplateLibrary/Vector.hpp"
 #include "TemplateLibrary/ByteBuffer.hpp"
 #include "Implementation/PacketDispatcher.hpp"
@@ -47,8 +49,17 @@ public:
     }
     bool addDispatcher(PacketDispatcher* packetParser) noexcept;
 
+    /// @brief Dispatches the first complete packet in the buffer, discarding any bytes preceding it.
+    /// @return Whether more data is needed, i.e. no packet was dispatched.
     bool dispatchNextPacket() noexcept;
 
+    /// @brief Dispatches every complete packet in the buffer in a single pass.
+    /// @return The number of packets dispatched.
+    size_t dispatchAllPackets() noexcept;
+
+    /// @brief Forgets any partial packet awaiting more data. To be called when the byte buffer is reset, e.g. after changing baud rate.
+    void reset() noexcept;
+
     void registerSkippedByteBuffer(ByteBuffer* const skippedByteBuffer) noexcept { _pSkippedByteBuffer = skippedByteBuffer; };
     void deregisterSkippedByteBuffer() noexcept { _pSkippedByteBuffer = nullptr; };
 
@@ -60,17 +71,29 @@ public:
     size_t getValidPacketCount(const SyncBytes& syncByte) const noexcept;
     size_t getInvalidPacketCount(const SyncBytes& syncByte) const noexcept;
 
+    /// @brief Gets the number of packets of any type. Safe to call while another thread dispatches packets.
+    size_t getValidPacketCount() const noexcept;
+    size_t getInvalidPacketCount() const noexcept;
+
 private:
     struct InternalItem
     {
         PacketDispatcher* packetDispatcher = nullptr;
         SyncBytes syncBytes{};
         PacketDispatcher::FindPacketRetVal latestRetVal{};
-        mutable size_t numValidPackets = 0;
-        mutable size_t numInvalidPackets = 0;
     };
 
     Vector<InternalItem, PACKET_PARSER_CAPACITY> _dispatchers{};
+    // Indexed as _dispatchers. Atomic, as they are read from other threads while packets are dispatched.
+    std::array<std::atomic<size_t>, PACKET_PARSER_CAPACITY> _numValidPackets{};
+    std::array<std::atomic<size_t>, PACKET_PARSER_CAPACITY> _numInvalidPackets{};
+    size_t _dispatchPackets(const size_t maxNumPackets) noexcept;
+
+    // Sync byte scanning. Unused slots of _syncByteSet repeat an existing sync byte so the vectorized compare needs no bounds.
+    std::array<uint8_t, PACKET_PARSER_CAPACITY> _syncByteSet{};
+    std::array<bool, 256> _isSyncByte{};
+    size_t _findNextSyncByte(size_t fromHeadIndex, const size_t byteBufferSize) const noexcept;
+    const uint8_t* _scanForSyncByte(const uint8_t* begin, const uint8_t* end) const noexcept;
 
     ByteBuffer* _pSkippedByteBuffer = nullptr;
     void _copyToSkippedByteBufferIfEnabled(const size_t numBytesToCopy) const noexcept;
@@ -26,20 +26,59 @@
 #define IMPLEMENTATION_QUEUEDEFINITIONS_HPP
 
 #include <memory>
+#include <type_traits>
+#include <variant>
 
 #include "TemplateLibrary/DirectAccessQueue.hpp"
+#include "TemplateLibrary/LockFreeDirectAccessQueue.hpp"
 #include "Implementation/Packet.hpp"
 #include "Interface/CompositeData.hpp"
+#include "Interface/CompactCompositeData.hpp"
 #include "Config.hpp"
 
 namespace VN
 {
-using MeasurementQueue = DirectAccessQueue<CompositeData, Config::PacketDispatchers::compositeDataQueueCapacity>;
+/// @brief The type held by the MeasurementQueue.
+using MeasurementData = std::conditional_t<Config::PacketDispatchers::compactMeasurementQueue, CompactCompositeData, CompositeData>;
+
+#if (THREADING_ENABLE)
+// Filled only by the listening thread, so a single producer queue suffices.
+using MeasurementQueue = LockFreeDirectAccessQueue<MeasurementData, Config::PacketDispatchers::compositeDataQueueCapacity>;
+#else
+using MeasurementQueue = DirectAccessQueue<MeasurementData, Config::PacketDispatchers::compositeDataQueueCapacity>;
+#endif
+
+/// @brief Where a dispatcher parses a measurement bound for a CompactCompositeData queue slot. Empty if the queue holds CompositeData.
+using MeasurementParseBuffer = std::conditional_t<Config::PacketDispatchers::compactMeasurementQueue, CompositeData, std::monostate>;
+
+/// @brief Gets the CompositeData to parse a measurement into, which for a CompositeData queue slot is the slot itself.
+inline CompositeData& measurementToParseInto(CompositeData& queueSlot, std::monostate&) noexcept { return queueSlot; }
+
+/// @brief Gets the CompositeData to parse a measurement into, to be packed into the CompactCompositeData queue slot by storeParsedMeasurement.
+inline CompositeData& measurementToParseInto(CompactCompositeData&, CompositeData& parseBuffer) noexcept { return parseBuffer; }
+
+inline void storeParsedMeasurement(CompositeData&, const CompositeData&) noexcept {}  // Parsed in place
+
+inline void storeParsedMeasurement(CompactCompositeData& queueSlot, const CompositeData& parsed) noexcept { queueSlot.pack(parsed); }
 
 using PacketQueue_Interface = DirectAccessQueue_Interface<Packet>;
 
 template <uint16_t Capacity>
 using PacketQueue = DirectAccessQueue<Packet, Capacity>;
+
+/// @brief Puts a packet into a subscriber's queue, sharing its bytes from the dispatcher's arena, or copying them into the slot's own buffer if the arena
+/// had no room. A packet with nowhere to hold its bytes is dropped just as it would be if the queue were full.
+/// @return The slot, whose details are left to be filled in, or a null pointer if the packet was dropped.
+inline PacketQueue_Interface::OwningPtr putSubscriberPacket(PacketQueue_Interface* queueToPush, const ByteBuffer& byteBuffer, const size_t syncByteIndex,
+                                                            const size_t packetLength, const SharedPacketBuffer& sharedBuffer) noexcept
+{
+    auto putSlot = queueToPush->put();
+    if (!putSlot) { return putSlot; }
+    if (sharedBuffer) { putSlot->share(sharedBuffer); }
+    else if (putSlot->useOwnBuffer() >= packetLength) { byteBuffer.peek_unchecked(putSlot->buffer, packetLength, syncByteIndex); }
+    else { putSlot.abandon(); }
+    return putSlot;
+}
 }  // namespace VN
 
 #endif  // IMPLEMENTATION_QUEUEDEFINITIONS_HPP
@@ -0,0 +1,90 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef IMPLEMENTATION_RECEIVEDTIMES_HPP
+#define IMPLEMENTATION_RECEIVEDTIMES_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include "Config.hpp"
+#include "HAL/Duration.hpp"
+#include "HAL/Timer.hpp"
+#include "TemplateLibrary/ByteBuffer.hpp"
+
+namespace VN
+{
+
+/// @brief Remembers when the most recent reads into a ByteBuffer arrived, so that packets can be stamped with when they arrived rather than when they were
+/// found. Reads are keyed by the stream position of their bytes, so they stay valid as the buffer wraps, discards and resets.
+class ReceivedTimes
+{
+public:
+    ReceivedTimes(const ByteBuffer& byteBuffer) : _byteBuffer(byteBuffer) {}
+
+    ReceivedTimes(const ReceivedTimes& other) = delete;
+    ReceivedTimes& operator=(const ReceivedTimes& other) = delete;
+
+    /// @brief Records that the numBytes most recently put or committed to the buffer arrived at receivedAt. Must be called on the thread which reads the buffer.
+    /// @param byteDuration The time taken to transmit one byte. Each byte is back-dated by this for every byte received after it in the same read.
+    void record(const size_t numBytes, const time_point receivedAt, const Nanoseconds byteDuration = Nanoseconds(0)) noexcept
+    {
+        if ((numBytes == 0) || (numBytes > _byteBuffer.size())) { return; }
+        const uint64_t end = _byteBuffer.numBytesDiscarded() + _byteBuffer.size();
+        _reads[_nextRead] = Read{end - numBytes, end, receivedAt, byteDuration};
+        _nextRead = (_nextRead + 1) % _reads.size();
+    }
+
+    /// @brief When the byte at index in the buffer arrived, if it was recorded and has not been evicted by later reads.
+    std::optional<time_point> at(const size_t index) const noexcept
+    {
+        const uint64_t position = _byteBuffer.numBytesDiscarded() + index;
+        for (const Read& read : _reads)
+        {
+            if ((position >= read.begin) && (position < read.end)) { return read.time - static_cast<int64_t>(read.end - 1 - position) * read.byteDuration; }
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Whether these are the receive times of byteBuffer.
+    bool isOf(const ByteBuffer& byteBuffer) const noexcept { return &byteBuffer == &_byteBuffer; }
+
+private:
+    struct Read
+    {
+        uint64_t begin = 0;
+        uint64_t end = 0;  // Empty until recorded
+        time_point time;
+        Nanoseconds byteDuration{0};
+    };
+
+    const ByteBuffer& _byteBuffer;
+    std::array<Read, Config::PacketFinders::receivedTimeCapacity> _reads{};
+    uint8_t _nextRead = 0;
+};
+
+}  // namespace VN
+
+#endif  // IMPLEMENTATION_RECEIVEDTIMES_HPP
@@ -199,6 +199,8 @@ public:
     }
 };
 
+class ConfigurationRegister;
+
 /// @brief This is the base class used by all register definitions. Its derived classes are directly used by the user.
 class Register
 {
@@ -233,6 +235,9 @@ public:
     /// @brief Gets the name of the register.
     virtual std::string name() = 0;
 
+    /// @brief Gets this register as a configuration register, or nullptr if it is a measurement register.
+    virtual ConfigurationRegister* asConfigurationRegister() { return nullptr; }
+
 protected:
     uint8_t _id;
 };
@@ -262,6 +267,8 @@ public:
         return Command{responseMatch, static_cast<uint8_t>((_id > 99) ? 7 : 6)};
     }
 
+    ConfigurationRegister* asConfigurationRegister() override { return this; }
+
 protected:
     using Register::_id;
 };
@@ -0,0 +1,393 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef __COMPACTCOMPOSITEDATA_HPP__
+#define __COMPACTCOMPOSITEDATA_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <variant>
+#include "Config.hpp"
+#include "Interface/CompositeData.hpp"
+
+namespace VN
+{
+/// @brief A sparse alternative to CompositeData, holding only the fields present in a measurement.
+/// Fields are packed back-to-back into a fixed storage block alongside a per-group presence mask, and the variable length GNSS fields (GnssSatInfo,
+/// GnssRawMeas) only occupy space for the satellites reported. Fields are addressed with the same group and field names as CompositeData, e.g.
+/// compactData.get(&CompositeData::ImuGroup::angularRate), and the full CompositeData can be recovered with toCompositeData. If
+/// Config::PacketDispatchers::compactMeasurementQueue, the MeasurementQueue holds this type.
+class CompactCompositeData
+{
+public:
+    /// @brief Binary group indices of the groups held by CompositeData. A field's group slot is its group's position in this array.
+    static constexpr std::array<uint8_t, 7> groupIndices = {1, 2, 3, 4, 5, 6, 12};
+    using PresenceMask = std::array<uint32_t, groupIndices.size()>;
+
+    CompactCompositeData() noexcept {};
+
+    CompactCompositeData(AsciiHeader asciiHeader) noexcept : _asciiHeader(asciiHeader) {};
+
+    CompactCompositeData(BinaryHeader binaryHeader) noexcept : _binaryHeader(binaryHeader) {};
+
+    /// @brief Packs every populated field of a CompositeData. Fields which do not fit the storage capacity are dropped.
+    explicit CompactCompositeData(const CompositeData& compositeData) noexcept { pack(compositeData); }
+
+    CompactCompositeData(const CompactCompositeData& other) noexcept { *this = other; }
+
+    /// @brief Copies only the populated portion of the field storage.
+    CompactCompositeData& operator=(const CompactCompositeData& other) noexcept
+    {
+        if (this == &other) { return *this; }
+        timestamp = other.timestamp;
+        asciiAppendCount = other.asciiAppendCount;
+        asciiAppendStatus = other.asciiAppendStatus;
+        _asciiHeader = other._asciiHeader;
+        _binaryHeader = other._binaryHeader;
+        _presence = other._presence;
+        _numEntries = other._numEntries;
+        _overflowed = other._overflowed;
+        _storageSize = other._storageSize;
+        std::copy_n(other._entries.begin(), _numEntries, _entries.begin());
+        std::copy_n(other._storage.begin(), _storageSize, _storage.begin());
+        return *this;
+    }
+
+    /// @brief Checks whether the passed header matches the header of the message which populated this object.
+    bool matchesMessage(const AsciiHeader& asciiHeader) const noexcept { return _asciiHeader.has_value() && (asciiHeader == _asciiHeader); }
+
+    /// @brief Checks whether the passed header matches the header of the message which populated this object.
+    bool matchesMessage(const BinaryHeader& binaryHeader) const noexcept { return _binaryHeader.has_value() && (binaryHeader == _binaryHeader); }
+
+    /// @brief Checks whether the passed register matches the header of the message which populated this object.
+    bool matchesMessage(const Registers::System::BinaryOutput& binaryOutputRegister) const noexcept
+    {
+        return matchesMessage(binaryOutputRegister.toBinaryHeader());
+    }
+
+    std::variant<AsciiHeader, BinaryHeader> header() const noexcept
+    {
+        if (_asciiHeader.has_value()) { return _asciiHeader.value(); }
+        else if (_binaryHeader.has_value()) { return _binaryHeader.value(); }
+        else { VN_ABORT(); }
+    }
+
+    /// @brief Replaces the contents with every populated field of a CompositeData. Fields which do not fit the storage capacity are dropped.
+    void pack(const CompositeData& compositeData) noexcept
+    {
+        _clear();
+        timestamp = compositeData.timestamp;
+        asciiAppendCount = compositeData.asciiAppendCount;
+        asciiAppendStatus = compositeData.asciiAppendStatus;
+        _asciiHeader = compositeData._asciiHeader;
+        _binaryHeader = compositeData._binaryHeader;
+
+        FieldPacker packer{*this};
+        for (packer.groupSlot = 0; packer.groupSlot < groupIndices.size(); ++packer.groupSlot)
+        {
+            for (packer.field = 0; packer.field < _fieldsPerGroup; ++packer.field)
+            {
+                compositeData.visitField(packer, groupIndices[packer.groupSlot], packer.field);
+            }
+        }
+    }
+
+    /// @brief The fields held, as a bitmask of field indices for each group slot.
+    const PresenceMask& presence() const noexcept { return _presence; }
+
+    /// @brief Checks whether a field is held.
+    /// @param measGroupIndex The binary group index of the field, excluding the common group (0).
+    /// @param measTypeIndex The field index within the group.
+    bool has(const uint8_t measGroupIndex, const uint8_t measTypeIndex) const noexcept
+    {
+        const auto groupSlot = _groupSlot(measGroupIndex);
+        return groupSlot.has_value() && (measTypeIndex < _fieldsPerGroup) && (_presence[*groupSlot] & (1u << measTypeIndex));
+    }
+
+    /// @brief The number of fields held.
+    size_t size() const noexcept { return _numEntries; }
+
+    /// @brief Whether any field was dropped because it did not fit the storage or field capacity.
+    bool overflowed() const noexcept { return _overflowed; }
+
+    /// @brief Gets a field by its CompositeData name, e.g. get(&CompositeData::AttitudeGroup::ypr).
+    /// @return The field's value, or nullopt if it is not held.
+    template <class Group, class T>
+    std::optional<T> get(std::optional<T> Group::*field) const noexcept
+    {
+        const Group* groupTag = nullptr;
+        const uint8_t groupSlot = _groupSlotOf(groupTag);
+        if (_presence[groupSlot] == 0) { return std::nullopt; }
+
+        // An empty CompositeData only names the field; each of the group's entries is looked up in it until one lands on the requested member.
+        CompositeData fields;
+        std::optional<T>& target = _groupOf(fields, groupTag).*field;
+        MemberFinder finder{&target};
+        for (uint8_t i = 0; i < _numEntries; ++i)
+        {
+            if (_entries[i].groupSlot != groupSlot) { continue; }
+            fields.copyFromBuffer(finder, groupIndices[groupSlot], _entries[i].field);
+            if (finder.found)
+            {
+                _decode(&_storage[_entries[i].offset], target.emplace());
+                return target;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Expands into a full CompositeData.
+    CompositeData toCompositeData() const noexcept
+    {
+        CompositeData compositeData;
+        if (_binaryHeader.has_value()) { compositeData.reset(_binaryHeader.value()); }
+        else if (_asciiHeader.has_value()) { compositeData.reset(_asciiHeader.value()); }
+        compositeData.timestamp = timestamp;
+        compositeData.asciiAppendCount = asciiAppendCount;
+        compositeData.asciiAppendStatus = asciiAppendStatus;
+
+        for (uint8_t i = 0; i < _numEntries; ++i)
+        {
+            FieldUnpacker unpacker{&_storage[_entries[i].offset]};
+            compositeData.copyFromBuffer(unpacker, groupIndices[_entries[i].groupSlot], _entries[i].field);
+        }
+        return compositeData;
+    }
+
+    time_point timestamp;
+
+    std::optional<uint32_t> asciiAppendCount;
+    std::optional<uint16_t> asciiAppendStatus;
+
+private:
+    struct Entry
+    {
+        uint8_t groupSlot;
+        uint8_t field;
+        uint16_t offset;
+    };
+
+    // Field indices extend past 16 bits through extension type words; copyFromBuffer shifts a signed 1 by the index, so 31 is the limit.
+    static constexpr uint8_t _fieldsPerGroup = 31;
+
+    std::optional<AsciiHeader> _asciiHeader = std::nullopt;
+    std::optional<BinaryHeader> _binaryHeader = std::nullopt;
+    PresenceMask _presence{};
+    uint8_t _numEntries = 0;
+    bool _overflowed = false;
+    uint16_t _storageSize = 0;
+    std::array<Entry, Config::CompactCompositeData::fieldCapacity> _entries;
+    alignas(8) std::array<uint8_t, Config::CompactCompositeData::storageCapacity> _storage;
+
+    void _clear() noexcept
+    {
+        _asciiHeader.reset();
+        _binaryHeader.reset();
+        _presence = {};
+        _numEntries = 0;
+        _overflowed = false;
+        _storageSize = 0;
+    }
+
+    static std::optional<uint8_t> _groupSlot(const uint8_t measGroupIndex) noexcept
+    {
+        for (uint8_t i = 0; i < groupIndices.size(); ++i)
+        {
+            if (groupIndices[i] == measGroupIndex) { return i; }
+        }
+        return std::nullopt;
+    }
+
+#if (TIME_GROUP_ENABLE)
+    static constexpr uint8_t _groupSlotOf(const CompositeData::TimeGroup*) noexcept { return 0; }
+    static CompositeData::TimeGroup& _groupOf(CompositeData& compositeData, const CompositeData::TimeGroup*) noexcept { return compositeData.time; }
+#endif
+#if (IMU_GROUP_ENABLE)
+    static constexpr uint8_t _groupSlotOf(const CompositeData::ImuGroup*) noexcept { return 1; }
+    static CompositeData::ImuGroup& _groupOf(CompositeData& compositeData, const CompositeData::ImuGroup*) noexcept { return compositeData.imu; }
+#endif
+#if (GNSS_GROUP_ENABLE)
+    static constexpr uint8_t _groupSlotOf(const CompositeData::GnssGroup*) noexcept { return 2; }
+    static CompositeData::GnssGroup& _groupOf(CompositeData& compositeData, const CompositeData::GnssGroup*) noexcept { return compositeData.gnss; }
+#endif
+#if (ATTITUDE_GROUP_ENABLE)
+    static constexpr uint8_t _groupSlotOf(const CompositeData::AttitudeGroup*) noexcept { return 3; }
+    static CompositeData::AttitudeGroup& _groupOf(CompositeData& compositeData, const CompositeData::AttitudeGroup*) noexcept
+    {
+        return compositeData.attitude;
+    }
+#endif
+#if (INS_GROUP_ENABLE)
+    static constexpr uint8_t _groupSlotOf(const CompositeData::InsGroup*) noexcept { return 4; }
+    static CompositeData::InsGroup& _groupOf(CompositeData& compositeData, const CompositeData::InsGroup*) noexcept { return compositeData.ins; }
+#endif
+#if (GNSS2_GROUP_ENABLE)
+    static constexpr uint8_t _groupSlotOf(const CompositeData::Gnss2Group*) noexcept { return 5; }
+    static CompositeData::Gnss2Group& _groupOf(CompositeData& compositeData, const CompositeData::Gnss2Group*) noexcept { return compositeData.gnss2; }
+#endif
+#if (GNSS3_GROUP_ENABLE)
+    static constexpr uint8_t _groupSlotOf(const CompositeData::Gnss3Group*) noexcept { return 6; }
+    static CompositeData::Gnss3Group& _groupOf(CompositeData& compositeData, const CompositeData::Gnss3Group*) noexcept { return compositeData.gnss3; }
+#endif
+
+    // ------------------------------------------
+    // Field packing
+    // ------------------------------------------
+
+    template <class T>
+    static uint16_t _encodedSize(const T&) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return sizeof(T);
+    }
+
+    template <class T>
+    static void _encode(uint8_t* dest, const T& value) noexcept
+    {
+        std::memcpy(dest, &value, sizeof(T));
+    }
+
+    template <class T>
+    static void _decode(const uint8_t* src, T& value) noexcept
+    {
+        std::memcpy(&value, src, sizeof(T));
+    }
+
+    template <class... Arrays>
+    static void _encodeArrays(uint8_t*& dest, const size_t count, const Arrays&... arrays) noexcept
+    {
+        ((std::memcpy(dest, arrays.data(), count * sizeof(arrays[0])), dest += count * sizeof(arrays[0])), ...);
+    }
+
+    template <class... Arrays>
+    static void _decodeArrays(const uint8_t*& src, const size_t count, Arrays&... arrays) noexcept
+    {
+        ((std::memcpy(arrays.data(), src, count * sizeof(arrays[0])), src += count * sizeof(arrays[0])), ...);
+    }
+
+    static uint16_t _encodedSize(const GnssSatInfo& value) noexcept { return 2 + std::min(value.numSats, SATELLITE_MAX_COUNT) * 8; }
+
+    static void _encode(uint8_t* dest, const GnssSatInfo& value) noexcept
+    {
+        *dest++ = value.numSats;
+        *dest++ = value.resv;
+        _encodeArrays(dest, std::min(value.numSats, SATELLITE_MAX_COUNT), value.sys, value.svId, value.flags, value.cno, value.qi, value.el, value.az);
+    }
+
+    static void _decode(const uint8_t* src, GnssSatInfo& value) noexcept
+    {
+        value.numSats = *src++;
+        value.resv = *src++;
+        _decodeArrays(src, std::min(value.numSats, SATELLITE_MAX_COUNT), value.sys, value.svId, value.flags, value.cno, value.qi, value.el, value.az);
+    }
+
+    static uint16_t _encodedSize(const GnssRawMeas& value) noexcept { return 12 + std::min(value.numMeas, SATELLITE_MAX_COUNT) * 28; }
+
+    static void _encode(uint8_t* dest, const GnssRawMeas& value) noexcept
+    {
+        std::memcpy(dest, &value.tow, sizeof(value.tow));
+        std::memcpy(dest + 8, &value.week, sizeof(value.week));
+        dest[10] = value.numMeas;
+        dest[11] = value.resv;
+        dest += 12;
+        _encodeArrays(dest, std::min(value.numMeas, SATELLITE_MAX_COUNT), value.sys, value.svId, value.band, value.chan, value.freqNum, value.cno,
+                      value.flags, value.pr, value.cp, value.dp);
+    }
+
+    static void _decode(const uint8_t* src, GnssRawMeas& value) noexcept
+    {
+        std::memcpy(&value.tow, src, sizeof(value.tow));
+        std::memcpy(&value.week, src + 8, sizeof(value.week));
+        value.numMeas = src[10];
+        value.resv = src[11];
+        src += 12;
+        _decodeArrays(src, std::min(value.numMeas, SATELLITE_MAX_COUNT), value.sys, value.svId, value.band, value.chan, value.freqNum, value.cno,
+                      value.flags, value.pr, value.cp, value.dp);
+    }
+
+    /// @brief Appends a field to the storage. Fields which do not fit are dropped and flagged.
+    template <class T>
+    void _pack(const uint8_t groupSlot, const uint8_t field, const T& value) noexcept
+    {
+        const uint16_t size = _encodedSize(value);
+        if (((_storageSize + size) > _storage.size()) || (_numEntries >= _entries.size()))
+        {
+            _overflowed = true;
+            return;
+        }
+        _entries[_numEntries++] = Entry{groupSlot, field, _storageSize};
+        _presence[groupSlot] |= (1u << field);
+        _encode(&_storage[_storageSize], value);
+        _storageSize += size;
+    }
+
+    /// @brief Packs the field of a CompositeData it is passed, if it is populated.
+    struct FieldPacker
+    {
+        CompactCompositeData& destination;
+        uint8_t groupSlot = 0;
+        uint8_t field = 0;
+
+        template <class T>
+        bool extract(const std::optional<T>& member) noexcept
+        {
+            if (member.has_value()) { destination._pack(groupSlot, field, member.value()); }
+            return false;
+        }
+    };
+
+    /// @brief Populates the field of a CompositeData it is passed from a packed entry.
+    struct FieldUnpacker
+    {
+        const uint8_t* source;
+
+        template <class T>
+        bool extract(std::optional<T>& member) noexcept
+        {
+            _decode(source, member.emplace());
+            return false;
+        }
+    };
+
+    /// @brief Records whether the field of a CompositeData it is passed is the one sought, without touching it.
+    struct MemberFinder
+    {
+        const void* target;
+        bool found = false;
+
+        template <class T>
+        bool extract(std::optional<T>& member) noexcept
+        {
+            found = (static_cast<const void*>(&member) == target);
+            return false;
+        }
+    };
+};  // class CompactCompositeData
+
+}  // namespace VN
+
+#endif  //__COMPACTCOMPOSITEDATA_HPP__
@@ -429,6 +429,36 @@ public:
         return matchesMessage(binaryOutputRegister.toBinaryHeader());
     }
 
+    /// @brief Prepares a reused object, such as a measurement queue slot, to hold a new binary packet. Rather than clearing every field, only the
+    /// fields populated by the previously held binary packet are cleared.
+    /// @param binaryHeader The header of the packet about to be held.
+    void reset(const BinaryHeader& binaryHeader) noexcept
+    {
+        _clearPreviousFields();
+        _asciiHeader.reset();
+        _binaryHeader = binaryHeader;
+        _parsedMeasurements.reset();
+    }
+
+    /// @brief Prepares a reused object to hold only the measurements of a new binary packet which are in measurementsToParse. The next reset then
+    /// clears only those of its fields.
+    /// @param binaryHeader The header of the packet about to be held.
+    /// @param measurementsToParse The measurements which will be parsed out of the packet.
+    void reset(const BinaryHeader& binaryHeader, const EnabledMeasurements& measurementsToParse) noexcept
+    {
+        reset(binaryHeader);
+        _parsedMeasurements = measurementsToParse;
+    }
+
+    /// @brief Prepares a reused object, such as a measurement queue slot, to hold a new ASCII packet.
+    /// @param asciiHeader The header of the packet about to be held.
+    void reset(const AsciiHeader& asciiHeader) noexcept
+    {
+        _clearPreviousFields();
+        _binaryHeader.reset();
+        _asciiHeader = asciiHeader;
+    }
+
     std::variant<AsciiHeader, BinaryHeader> header() const noexcept
     {
         if (_asciiHeader.has_value()) { return _asciiHeader.value(); }
@@ -464,16 +494,63 @@ public:
     std::optional<uint16_t> asciiAppendStatus;
 
     template <class Extractor>
-    bool copyFromBuffer(Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex);
+    bool copyFromBuffer(Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex)
+    {
+        return _accessField(*this, extractor, measGroupIndex, measTypeIndex);
+    }
+
+    /// @brief Passes the field at measGroupIndex and measTypeIndex to visitor.extract as a const std::optional, without modifying it.
+    /// @return True if the field is not held by CompositeData, otherwise the result of visitor.extract.
+    template <class Visitor>
+    bool visitField(Visitor& visitor, const uint8_t measGroupIndex, const uint8_t measTypeIndex) const
+    {
+        return _accessField(*this, visitor, measGroupIndex, measTypeIndex);
+    }
 
 private:
     std::optional<AsciiHeader> _asciiHeader = std::nullopt;
     std::optional<BinaryHeader> _binaryHeader = std::nullopt;
+    std::optional<EnabledMeasurements> _parsedMeasurements = std::nullopt;  // Of the binary packet held, if not all of them were parsed
+
+    friend class CompactCompositeData;
+
+    /// @brief Maps a group and field index to its member, shared by copyFromBuffer and visitField. Self is CompositeData or const CompositeData.
+    template <class Self, class Extractor>
+    static bool _accessField(Self& self, Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex);
+
+    /// @brief An extractor which clears, rather than populates, each field it is passed.
+    struct FieldResetter
+    {
+        template <class T>
+        bool extract(std::optional<T>& value) noexcept
+        {
+            value.reset();
+            return false;
+        }
+    };
+
+    void _clearPreviousFields() noexcept
+    {
+        if (_binaryHeader.has_value())
+        {
+            FieldResetter resetter;
+            BinaryHeaderIterator iter(_binaryHeader.value());
+            while (iter.next())
+            {
+                // Fields which were not parsed were never populated
+                if (_parsedMeasurements.has_value() && !holdsAnyMeasurement(_parsedMeasurements.value(), iter.group(), iter.field())) { continue; }
+                copyFromBuffer(resetter, iter.group(), iter.field());
+            }
+        }
+        else if (_asciiHeader.has_value()) { *this = CompositeData(); }  // ASCII fields are not derivable from the header alone.
+        asciiAppendCount.reset();
+        asciiAppendStatus.reset();
+    }
 
 };  // class CompositeData
 
-template <class Extractor>
-bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex)
+template <class Self, class Extractor>
+bool CompositeData::_accessField(Self& self, Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex)
 {
     switch (measGroupIndex)
     {
@@ -484,105 +561,105 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
 #if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
                 case COMMON_TIMESTARTUP_BIT:
                 {
-                    return extractor.extract(time.timeStartup);
+                    return extractor.extract(self.time.timeStartup);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
                 case COMMON_TIMEGPS_BIT:
                 {
-                    return extractor.extract(time.timeGps);
+                    return extractor.extract(self.time.timeGps);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
                 case COMMON_TIMESYNCIN_BIT:
                 {
-                    return extractor.extract(time.timeSyncIn);
+                    return extractor.extract(self.time.timeSyncIn);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT)
                 case COMMON_YPR_BIT:
                 {
-                    return extractor.extract(attitude.ypr);
+                    return extractor.extract(self.attitude.ypr);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT)
                 case COMMON_QUATERNION_BIT:
                 {
-                    return extractor.extract(attitude.quaternion);
+                    return extractor.extract(self.attitude.quaternion);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
                 case COMMON_ANGULARRATE_BIT:
                 {
-                    return extractor.extract(imu.angularRate);
+                    return extractor.extract(self.imu.angularRate);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_POSLLA_BIT)
                 case COMMON_POSLLA_BIT:
                 {
-                    return extractor.extract(ins.posLla);
+                    return extractor.extract(self.ins.posLla);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_VELNED_BIT)
                 case COMMON_VELNED_BIT:
                 {
-                    return extractor.extract(ins.velNed);
+                    return extractor.extract(self.ins.velNed);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
                 case COMMON_ACCEL_BIT:
                 {
-                    return extractor.extract(imu.accel);
+                    return extractor.extract(self.imu.accel);
                 }
 #endif
 
 #if ((IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT) && (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT))
                 case COMMON_IMU_BIT:
                 {
-                    return !(!extractor.extract(imu.uncompAccel) && !extractor.extract(imu.uncompGyro));
+                    return !(!extractor.extract(self.imu.uncompAccel) && !extractor.extract(self.imu.uncompGyro));
                 }
 #endif
 
 #if ((IMU_GROUP_ENABLE & IMU_MAG_BIT) && (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT) && (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT))
                 case COMMON_MAGPRES_BIT:
                 {
-                    return !(!extractor.extract(imu.mag) && !extractor.extract(imu.temperature) && !extractor.extract(imu.pressure));
+                    return !(!extractor.extract(self.imu.mag) && !extractor.extract(self.imu.temperature) && !extractor.extract(self.imu.pressure));
                 }
 #endif
 
 #if ((IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT) && (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT))
                 case COMMON_DELTAS_BIT:
                 {
-                    return !(!extractor.extract(imu.deltaTheta) && !extractor.extract(imu.deltaVel));
+                    return !(!extractor.extract(self.imu.deltaTheta) && !extractor.extract(self.imu.deltaVel));
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_INSSTATUS_BIT)
                 case COMMON_INSSTATUS_BIT:
                 {
-                    return extractor.extract(ins.insStatus);
+                    return extractor.extract(self.ins.insStatus);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_SYNCINCNT_BIT)
                 case COMMON_SYNCINCNT_BIT:
                 {
-                    return extractor.extract(time.syncInCnt);
+                    return extractor.extract(self.time.syncInCnt);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMEGPSPPS_BIT)
                 case COMMON_TIMEGPSPPS_BIT:
                 {
-                    return extractor.extract(time.timeGpsPps);
+                    return extractor.extract(self.time.timeGpsPps);
                 }
 #endif
 
@@ -600,70 +677,70 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
 #if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
                 case TIME_TIMESTARTUP_BIT:
                 {
-                    return extractor.extract(time.timeStartup);
+                    return extractor.extract(self.time.timeStartup);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
                 case TIME_TIMEGPS_BIT:
                 {
-                    return extractor.extract(time.timeGps);
+                    return extractor.extract(self.time.timeGps);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMEGPSTOW_BIT)
                 case TIME_TIMEGPSTOW_BIT:
                 {
-                    return extractor.extract(time.timeGpsTow);
+                    return extractor.extract(self.time.timeGpsTow);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMEGPSWEEK_BIT)
                 case TIME_TIMEGPSWEEK_BIT:
                 {
-                    return extractor.extract(time.timeGpsWeek);
+                    return extractor.extract(self.time.timeGpsWeek);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
                 case TIME_TIMESYNCIN_BIT:
                 {
-                    return extractor.extract(time.timeSyncIn);
+                    return extractor.extract(self.time.timeSyncIn);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMEGPSPPS_BIT)
                 case TIME_TIMEGPSPPS_BIT:
                 {
-                    return extractor.extract(time.timeGpsPps);
+                    return extractor.extract(self.time.timeGpsPps);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMEUTC_BIT)
                 case TIME_TIMEUTC_BIT:
                 {
-                    return extractor.extract(time.timeUtc);
+                    return extractor.extract(self.time.timeUtc);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_SYNCINCNT_BIT)
                 case TIME_SYNCINCNT_BIT:
                 {
-                    return extractor.extract(time.syncInCnt);
+                    return extractor.extract(self.time.syncInCnt);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_SYNCOUTCNT_BIT)
                 case TIME_SYNCOUTCNT_BIT:
                 {
-                    return extractor.extract(time.syncOutCnt);
+                    return extractor.extract(self.time.syncOutCnt);
                 }
 #endif
 
 #if (TIME_GROUP_ENABLE & TIME_TIMESTATUS_BIT)
                 case TIME_TIMESTATUS_BIT:
                 {
-                    return extractor.extract(time.timeStatus);
+                    return extractor.extract(self.time.timeStatus);
                 }
 #endif
 
@@ -682,84 +759,84 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
 #if (IMU_GROUP_ENABLE & IMU_IMUSTATUS_BIT)
                 case IMU_IMUSTATUS_BIT:
                 {
-                    return extractor.extract(imu.imuStatus);
+                    return extractor.extract(self.imu.imuStatus);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT)
                 case IMU_UNCOMPMAG_BIT:
                 {
-                    return extractor.extract(imu.uncompMag);
+                    return extractor.extract(self.imu.uncompMag);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT)
                 case IMU_UNCOMPACCEL_BIT:
                 {
-                    return extractor.extract(imu.uncompAccel);
+                    return extractor.extract(self.imu.uncompAccel);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT)
                 case IMU_UNCOMPGYRO_BIT:
                 {
-                    return extractor.extract(imu.uncompGyro);
+                    return extractor.extract(self.imu.uncompGyro);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT)
                 case IMU_TEMPERATURE_BIT:
                 {
-                    return extractor.extract(imu.temperature);
+                    return extractor.extract(self.imu.temperature);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT)
                 case IMU_PRESSURE_BIT:
                 {
-                    return extractor.extract(imu.pressure);
+                    return extractor.extract(self.imu.pressure);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT)
                 case IMU_DELTATHETA_BIT:
                 {
-                    return extractor.extract(imu.deltaTheta);
+                    return extractor.extract(self.imu.deltaTheta);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT)
                 case IMU_DELTAVEL_BIT:
                 {
-                    return extractor.extract(imu.deltaVel);
+                    return extractor.extract(self.imu.deltaVel);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_MAG_BIT)
                 case IMU_MAG_BIT:
                 {
-                    return extractor.extract(imu.mag);
+                    return extractor.extract(self.imu.mag);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
                 case IMU_ACCEL_BIT:
                 {
-                    return extractor.extract(imu.accel);
+                    return extractor.extract(self.imu.accel);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
                 case IMU_ANGULARRATE_BIT:
                 {
-                    return extractor.extract(imu.angularRate);
+                    return extractor.extract(self.imu.angularRate);
                 }
 #endif
 
 #if (IMU_GROUP_ENABLE & IMU_SENSSAT_BIT)
                 case IMU_SENSSAT_BIT:
                 {
-                    return extractor.extract(imu.sensSat);
+                    return extractor.extract(self.imu.sensSat);
                 }
 #endif
 
@@ -778,126 +855,126 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUTC_BIT)
                 case GNSS_GNSS1TIMEUTC_BIT:
                 {
-                    return extractor.extract(gnss.gnss1TimeUtc);
+                    return extractor.extract(self.gnss.gnss1TimeUtc);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GPS1TOW_BIT)
                 case GNSS_GPS1TOW_BIT:
                 {
-                    return extractor.extract(gnss.gps1Tow);
+                    return extractor.extract(self.gnss.gps1Tow);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GPS1WEEK_BIT)
                 case GNSS_GPS1WEEK_BIT:
                 {
-                    return extractor.extract(gnss.gps1Week);
+                    return extractor.extract(self.gnss.gps1Week);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1NUMSATS_BIT)
                 case GNSS_GNSS1NUMSATS_BIT:
                 {
-                    return extractor.extract(gnss.gnss1NumSats);
+                    return extractor.extract(self.gnss.gnss1NumSats);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1FIX_BIT)
                 case GNSS_GNSS1FIX_BIT:
                 {
-                    return extractor.extract(gnss.gnss1Fix);
+                    return extractor.extract(self.gnss.gnss1Fix);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSLLA_BIT)
                 case GNSS_GNSS1POSLLA_BIT:
                 {
-                    return extractor.extract(gnss.gnss1PosLla);
+                    return extractor.extract(self.gnss.gnss1PosLla);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSECEF_BIT)
                 case GNSS_GNSS1POSECEF_BIT:
                 {
-                    return extractor.extract(gnss.gnss1PosEcef);
+                    return extractor.extract(self.gnss.gnss1PosEcef);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELNED_BIT)
                 case GNSS_GNSS1VELNED_BIT:
                 {
-                    return extractor.extract(gnss.gnss1VelNed);
+                    return extractor.extract(self.gnss.gnss1VelNed);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELECEF_BIT)
                 case GNSS_GNSS1VELECEF_BIT:
                 {
-                    return extractor.extract(gnss.gnss1VelEcef);
+                    return extractor.extract(self.gnss.gnss1VelEcef);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSUNCERTAINTY_BIT)
                 case GNSS_GNSS1POSUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss.gnss1PosUncertainty);
+                    return extractor.extract(self.gnss.gnss1PosUncertainty);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELUNCERTAINTY_BIT)
                 case GNSS_GNSS1VELUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss.gnss1VelUncertainty);
+                    return extractor.extract(self.gnss.gnss1VelUncertainty);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUNCERTAINTY_BIT)
                 case GNSS_GNSS1TIMEUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss.gnss1TimeUncertainty);
+                    return extractor.extract(self.gnss.gnss1TimeUncertainty);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEINFO_BIT)
                 case GNSS_GNSS1TIMEINFO_BIT:
                 {
-                    return extractor.extract(gnss.gnss1TimeInfo);
+                    return extractor.extract(self.gnss.gnss1TimeInfo);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1DOP_BIT)
                 case GNSS_GNSS1DOP_BIT:
                 {
-                    return extractor.extract(gnss.gnss1Dop);
+                    return extractor.extract(self.gnss.gnss1Dop);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1SATINFO_BIT)
                 case GNSS_GNSS1SATINFO_BIT:
                 {
-                    return extractor.extract(gnss.gnss1SatInfo);
+                    return extractor.extract(self.gnss.gnss1SatInfo);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT)
                 case GNSS_GNSS1RAWMEAS_BIT:
                 {
-                    return extractor.extract(gnss.gnss1RawMeas);
+                    return extractor.extract(self.gnss.gnss1RawMeas);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1STATUS_BIT)
                 case GNSS_GNSS1STATUS_BIT:
                 {
-                    return extractor.extract(gnss.gnss1Status);
+                    return extractor.extract(self.gnss.gnss1Status);
                 }
 #endif
 
 #if (GNSS_GROUP_ENABLE & GNSS_GNSS1ALTMSL_BIT)
                 case GNSS_GNSS1ALTMSL_BIT:
                 {
-                    return extractor.extract(gnss.gnss1AltMSL);
+                    return extractor.extract(self.gnss.gnss1AltMSL);
                 }
 #endif
 
@@ -916,70 +993,70 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT)
                 case ATTITUDE_YPR_BIT:
                 {
-                    return extractor.extract(attitude.ypr);
+                    return extractor.extract(self.attitude.ypr);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT)
                 case ATTITUDE_QUATERNION_BIT:
                 {
-                    return extractor.extract(attitude.quaternion);
+                    return extractor.extract(self.attitude.quaternion);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_DCM_BIT)
                 case ATTITUDE_DCM_BIT:
                 {
-                    return extractor.extract(attitude.dcm);
+                    return extractor.extract(self.attitude.dcm);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT)
                 case ATTITUDE_MAGNED_BIT:
                 {
-                    return extractor.extract(attitude.magNed);
+                    return extractor.extract(self.attitude.magNed);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT)
                 case ATTITUDE_ACCELNED_BIT:
                 {
-                    return extractor.extract(attitude.accelNed);
+                    return extractor.extract(self.attitude.accelNed);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT)
                 case ATTITUDE_LINBODYACC_BIT:
                 {
-                    return extractor.extract(attitude.linBodyAcc);
+                    return extractor.extract(self.attitude.linBodyAcc);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT)
                 case ATTITUDE_LINACCELNED_BIT:
                 {
-                    return extractor.extract(attitude.linAccelNed);
+                    return extractor.extract(self.attitude.linAccelNed);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPRU_BIT)
                 case ATTITUDE_YPRU_BIT:
                 {
-                    return extractor.extract(attitude.yprU);
+                    return extractor.extract(self.attitude.yprU);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_HEAVE_BIT)
                 case ATTITUDE_HEAVE_BIT:
                 {
-                    return extractor.extract(attitude.heave);
+                    return extractor.extract(self.attitude.heave);
                 }
 #endif
 
 #if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ATTU_BIT)
                 case ATTITUDE_ATTU_BIT:
                 {
-                    return extractor.extract(attitude.attU);
+                    return extractor.extract(self.attitude.attU);
                 }
 #endif
 
@@ -998,77 +1075,77 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
 #if (INS_GROUP_ENABLE & INS_INSSTATUS_BIT)
                 case INS_INSSTATUS_BIT:
                 {
-                    return extractor.extract(ins.insStatus);
+                    return extractor.extract(self.ins.insStatus);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_POSLLA_BIT)
                 case INS_POSLLA_BIT:
                 {
-                    return extractor.extract(ins.posLla);
+                    return extractor.extract(self.ins.posLla);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_POSECEF_BIT)
                 case INS_POSECEF_BIT:
                 {
-                    return extractor.extract(ins.posEcef);
+                    return extractor.extract(self.ins.posEcef);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_VELBODY_BIT)
                 case INS_VELBODY_BIT:
                 {
-                    return extractor.extract(ins.velBody);
+                    return extractor.extract(self.ins.velBody);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_VELNED_BIT)
                 case INS_VELNED_BIT:
                 {
-                    return extractor.extract(ins.velNed);
+                    return extractor.extract(self.ins.velNed);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_VELECEF_BIT)
                 case INS_VELECEF_BIT:
                 {
-                    return extractor.extract(ins.velEcef);
+                    return extractor.extract(self.ins.velEcef);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_MAGECEF_BIT)
                 case INS_MAGECEF_BIT:
                 {
-                    return extractor.extract(ins.magEcef);
+                    return extractor.extract(self.ins.magEcef);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_ACCELECEF_BIT)
                 case INS_ACCELECEF_BIT:
                 {
-                    return extractor.extract(ins.accelEcef);
+                    return extractor.extract(self.ins.accelEcef);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_LINACCELECEF_BIT)
                 case INS_LINACCELECEF_BIT:
                 {
-                    return extractor.extract(ins.linAccelEcef);
+                    return extractor.extract(self.ins.linAccelEcef);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_POSU_BIT)
                 case INS_POSU_BIT:
                 {
-                    return extractor.extract(ins.posU);
+                    return extractor.extract(self.ins.posU);
                 }
 #endif
 
 #if (INS_GROUP_ENABLE & INS_VELU_BIT)
                 case INS_VELU_BIT:
                 {
-                    return extractor.extract(ins.velU);
+                    return extractor.extract(self.ins.velU);
                 }
 #endif
 
@@ -1087,126 +1164,126 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUTC_BIT)
                 case GNSS2_GNSS2TIMEUTC_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2TimeUtc);
+                    return extractor.extract(self.gnss2.gnss2TimeUtc);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GPS2TOW_BIT)
                 case GNSS2_GPS2TOW_BIT:
                 {
-                    return extractor.extract(gnss2.gps2Tow);
+                    return extractor.extract(self.gnss2.gps2Tow);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GPS2WEEK_BIT)
                 case GNSS2_GPS2WEEK_BIT:
                 {
-                    return extractor.extract(gnss2.gps2Week);
+                    return extractor.extract(self.gnss2.gps2Week);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2NUMSATS_BIT)
                 case GNSS2_GNSS2NUMSATS_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2NumSats);
+                    return extractor.extract(self.gnss2.gnss2NumSats);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2FIX_BIT)
                 case GNSS2_GNSS2FIX_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2Fix);
+                    return extractor.extract(self.gnss2.gnss2Fix);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSLLA_BIT)
                 case GNSS2_GNSS2POSLLA_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2PosLla);
+                    return extractor.extract(self.gnss2.gnss2PosLla);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSECEF_BIT)
                 case GNSS2_GNSS2POSECEF_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2PosEcef);
+                    return extractor.extract(self.gnss2.gnss2PosEcef);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELNED_BIT)
                 case GNSS2_GNSS2VELNED_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2VelNed);
+                    return extractor.extract(self.gnss2.gnss2VelNed);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELECEF_BIT)
                 case GNSS2_GNSS2VELECEF_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2VelEcef);
+                    return extractor.extract(self.gnss2.gnss2VelEcef);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSUNCERTAINTY_BIT)
                 case GNSS2_GNSS2POSUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2PosUncertainty);
+                    return extractor.extract(self.gnss2.gnss2PosUncertainty);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELUNCERTAINTY_BIT)
                 case GNSS2_GNSS2VELUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2VelUncertainty);
+                    return extractor.extract(self.gnss2.gnss2VelUncertainty);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUNCERTAINTY_BIT)
                 case GNSS2_GNSS2TIMEUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2TimeUncertainty);
+                    return extractor.extract(self.gnss2.gnss2TimeUncertainty);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEINFO_BIT)
                 case GNSS2_GNSS2TIMEINFO_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2TimeInfo);
+                    return extractor.extract(self.gnss2.gnss2TimeInfo);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2DOP_BIT)
                 case GNSS2_GNSS2DOP_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2Dop);
+                    return extractor.extract(self.gnss2.gnss2Dop);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2SATINFO_BIT)
                 case GNSS2_GNSS2SATINFO_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2SatInfo);
+                    return extractor.extract(self.gnss2.gnss2SatInfo);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT)
                 case GNSS2_GNSS2RAWMEAS_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2RawMeas);
+                    return extractor.extract(self.gnss2.gnss2RawMeas);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2STATUS_BIT)
                 case GNSS2_GNSS2STATUS_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2Status);
+                    return extractor.extract(self.gnss2.gnss2Status);
                 }
 #endif
 
 #if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2ALTMSL_BIT)
                 case GNSS2_GNSS2ALTMSL_BIT:
                 {
-                    return extractor.extract(gnss2.gnss2AltMSL);
+                    return extractor.extract(self.gnss2.gnss2AltMSL);
                 }
 #endif
 
@@ -1225,126 +1302,126 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUTC_BIT)
                 case GNSS3_GNSS3TIMEUTC_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3TimeUtc);
+                    return extractor.extract(self.gnss3.gnss3TimeUtc);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GPS3TOW_BIT)
                 case GNSS3_GPS3TOW_BIT:
                 {
-                    return extractor.extract(gnss3.gps3Tow);
+                    return extractor.extract(self.gnss3.gps3Tow);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GPS3WEEK_BIT)
                 case GNSS3_GPS3WEEK_BIT:
                 {
-                    return extractor.extract(gnss3.gps3Week);
+                    return extractor.extract(self.gnss3.gps3Week);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3NUMSATS_BIT)
                 case GNSS3_GNSS3NUMSATS_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3NumSats);
+                    return extractor.extract(self.gnss3.gnss3NumSats);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3FIX_BIT)
                 case GNSS3_GNSS3FIX_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3Fix);
+                    return extractor.extract(self.gnss3.gnss3Fix);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSLLA_BIT)
                 case GNSS3_GNSS3POSLLA_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3PosLla);
+                    return extractor.extract(self.gnss3.gnss3PosLla);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSECEF_BIT)
                 case GNSS3_GNSS3POSECEF_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3PosEcef);
+                    return extractor.extract(self.gnss3.gnss3PosEcef);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELNED_BIT)
                 case GNSS3_GNSS3VELNED_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3VelNed);
+                    return extractor.extract(self.gnss3.gnss3VelNed);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELECEF_BIT)
                 case GNSS3_GNSS3VELECEF_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3VelEcef);
+                    return extractor.extract(self.gnss3.gnss3VelEcef);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSUNCERTAINTY_BIT)
                 case GNSS3_GNSS3POSUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3PosUncertainty);
+                    return extractor.extract(self.gnss3.gnss3PosUncertainty);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELUNCERTAINTY_BIT)
                 case GNSS3_GNSS3VELUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3VelUncertainty);
+                    return extractor.extract(self.gnss3.gnss3VelUncertainty);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUNCERTAINTY_BIT)
                 case GNSS3_GNSS3TIMEUNCERTAINTY_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3TimeUncertainty);
+                    return extractor.extract(self.gnss3.gnss3TimeUncertainty);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEINFO_BIT)
                 case GNSS3_GNSS3TIMEINFO_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3TimeInfo);
+                    return extractor.extract(self.gnss3.gnss3TimeInfo);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3DOP_BIT)
                 case GNSS3_GNSS3DOP_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3Dop);
+                    return extractor.extract(self.gnss3.gnss3Dop);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3SATINFO_BIT)
                 case GNSS3_GNSS3SATINFO_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3SatInfo);
+                    return extractor.extract(self.gnss3.gnss3SatInfo);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3RAWMEAS_BIT)
                 case GNSS3_GNSS3RAWMEAS_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3RawMeas);
+                    return extractor.extract(self.gnss3.gnss3RawMeas);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3STATUS_BIT)
                 case GNSS3_GNSS3STATUS_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3Status);
+                    return extractor.extract(self.gnss3.gnss3Status);
                 }
 #endif
 
 #if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3ALTMSL_BIT)
                 case GNSS3_GNSS3ALTMSL_BIT:
                 {
-                    return extractor.extract(gnss3.gnss3AltMSL);
+                    return extractor.extract(self.gnss3.gnss3AltMSL);
                 }
 #endif
 
@@ -1362,7 +1439,7 @@ bool CompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroup
         }
     }  // switch (measGroupIndex)
     return true;
-}  // CompositeData::copyFromBuffer
+}  // CompositeData::_accessField
 }  // namespace VN
 
 #endif  //__COMPOSITEDATA_HPP__
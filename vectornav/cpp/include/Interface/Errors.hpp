@@ -68,6 +68,12 @@ enum class Error : uint16_t
     SerialWriteFailed = 706,
     UnexpectedSerialError = 799,
 
+    // ThreadErrors
+    ThreadNotRunning = 800,
+    ThreadPermissionDenied = 801,
+    InvalidThreadAttributes = 802,
+    UnsupportedThreadAttributes = 803,
+
     // SensorErrors
     MeasurementQueueFull = 600,
     PrimaryBufferFull = 601,
@@ -137,6 +143,14 @@ inline static const char* errorCodeToString(Error error)
             return "SerialWriteFailed";
         case Error::MessageSubscriberCapacityReached:
             return "MessageSubscriberCapacityReached";
+        case Error::ThreadNotRunning:
+            return "ThreadNotRunning";
+        case Error::ThreadPermissionDenied:
+            return "ThreadPermissionDenied";
+        case Error::InvalidThreadAttributes:
+            return "InvalidThreadAttributes";
+        case Error::UnsupportedThreadAttributes:
+            return "UnsupportedThreadAttributes";
         default:
             return "Unknown error code.";
     }
@@ -31,6 +31,9 @@
 #include <array>
 
 #include "Config.hpp"
+#if (THREADING_ENABLE)
+#include <future>
+#endif
 #include "Implementation/MeasurementDatatypes.hpp"
 #include "HAL/Serial_Base.hpp"
 #include "Interface/Command.hpp"
@@ -38,6 +41,7 @@
 #include "HAL/Serial.hpp"
 #include "HAL/Thread.hpp"
 #include "HAL/Timer.hpp"
+#include "TemplateLibrary/Vector.hpp"
 #include "Implementation/QueueDefinitions.hpp"
 #include "Implementation/PacketSynchronizer.hpp"
 #include "Interface/Commands.hpp"
@@ -93,8 +97,9 @@ public:
     /// @param baudRate The baud rate at which to connect.
     Error connect(const Serial_Base::PortName& portName, const BaudRate baudRate) noexcept;
 
-    /// @brief Opens the serial port, scanning all possible baud rates until the unit is verified to be connected. This performs a verifySensorConnectivity at
-    /// each possible baud rate. If THREADING_ENABLE, this starts the Listening Thread.
+    /// @brief Opens the serial port, scanning all possible baud rates until the unit is verified to be connected. The baud rate this port last connected at
+    /// is verified first. Then each rate is listened to for autoConnectListenDuration, verifying connectivity only at a rate where the unit's output parses.
+    /// Only if the unit is silent is a verifySensorConnectivity performed at each possible baud rate. If THREADING_ENABLE, this starts the Listening Thread.
     /// @param portName The port name to which to connect.
     Error autoConnect(const Serial_Base::PortName& portName) noexcept;
 
@@ -120,22 +125,42 @@ public:
     /// @brief Disconnects from the unit. If THREADING_ENABLE, this closes the Listening Thread.
     void disconnect() noexcept;
 
+#if (THREADING_ENABLE)
+    /// @brief Sets the scheduling policy, priority, CPU affinity and name of the Listening Thread, which are reapplied each time it restarts. A real-time
+    /// policy keeps busier threads from preempting it for long enough to fill the main buffer. If the thread is running, returns the first attribute which
+    /// could not be applied, e.g. ThreadPermissionDenied if the process may not use real-time scheduling. Otherwise they are applied on connecting, and a
+    /// failure is pushed to the asynchronous error queue.
+    Error setListeningThreadAttributes(const ThreadAttributes& attributes) noexcept;
+#endif
+
     // ------------------------------------------
     /*! \name Accessing Measurements */
     // ------------------------------------------
 
-    using CompositeDataQueueReturn = DirectAccessQueue_Interface<CompositeData>::value_type;
+    /// @brief An owning pointer to a MeasurementQueue slot, holding a CompactCompositeData if Config::PacketDispatchers::compactMeasurementQueue, otherwise
+    /// a CompositeData.
+    using CompositeDataQueueReturn = DirectAccessQueue_Interface<MeasurementData>::value_type;
 
     /// @brief Checks to see if there is a new measurement available on the MeasurementQueue.
     bool hasMeasurement() const noexcept { return !_measurementQueue.isEmpty(); }
 
     /// @brief Gets (and pops) the front of the MeasurementQueue.
-    /// @param block If true, wait a maximum of getMeasurementTimeoutLength for a new measurement.
-    CompositeDataQueueReturn getNextMeasurement(const bool block = true) noexcept;
+    /// @param block If true, wait a maximum of timeout for a new measurement.
+    /// @param timeout The maximum time to wait if blocking. If THREADING_ENABLE, the wait sleeps until the listening thread queues a measurement.
+    CompositeDataQueueReturn getNextMeasurement(const bool block = true, const Microseconds timeout = Config::Sensor::getMeasurementTimeoutLength) noexcept;
 
     /// @brief Gets the back (most recent) of the MeasurementQueue, popping every measurement in the queue.
-    /// @param block If true, wait a maximum of getMeasurementTimeoutLength for a new measurement.
-    CompositeDataQueueReturn getMostRecentMeasurement(const bool block = true) noexcept;
+    /// @param block If true, wait a maximum of timeout for a new measurement.
+    /// @param timeout The maximum time to wait if blocking. If THREADING_ENABLE, the wait sleeps until the listening thread queues a measurement.
+    CompositeDataQueueReturn getMostRecentMeasurement(const bool block = true,
+                                                      const Microseconds timeout = Config::Sensor::getMeasurementTimeoutLength) noexcept;
+
+    /// @brief Moves every available measurement, up to maxCount, from the front of the MeasurementQueue into measurements, in order.
+    /// @param measurements The array to populate. Must hold at least maxCount measurements.
+    /// @param maxCount The maximum number of measurements to move.
+    /// @param timeout If the MeasurementQueue is empty, the maximum time to wait for a measurement. Zero to not wait.
+    /// @return The number of measurements moved.
+    uint16_t getMeasurements(MeasurementData* measurements, const uint16_t maxCount, const Microseconds timeout = Config::Sensor::getMeasurementTimeoutLength) noexcept;
 
     // ------------------------------------------
     /*! \name Sending Commands */
@@ -150,7 +175,8 @@ public:
                          ///< times before returning ResponseTimeout.
     };
 
-    /// @brief Sends a Read Register command to the unit to poll register values and blocks on the unit's response.
+    /// @brief Sends a Read Register command to the unit to poll register values and blocks on the unit's response. A configuration register's value is
+    /// then held in the register cache.
     /// @param registerToRead The register object to be populated by the unit's response.
     /// @param retryOnFailure Whether to retry sending the Read Register command to the unit if no confirmation is received within commandSendTimeoutLength.
     Error readRegister(Register* registerToRead, const bool retryOnFailure = true) CONST_IF_THREADED noexcept;
@@ -160,15 +186,53 @@ public:
     /// @param retryOnFailure Whether to retry sending the write register command to the unit if no cofirmation is received within commandSendTimeoutLength.
     Error writeRegister(ConfigurationRegister* registerToWrite, const bool retryOnFailure = true) CONST_IF_THREADED noexcept;
 
+    /// @brief Reads several registers, keeping up to maxCommandsInFlight Read Register commands outstanding rather than waiting on each response in turn.
+    /// Commands for the same register are never outstanding together, so each response is matched to the right command by FIFO order and register id.
+    /// @param registersToRead The register objects to be populated by the unit's responses.
+    /// @param count The number of registers to read.
+    /// @param retryOnFailure Whether to resend a command which is not answered within commandSendTimeoutLength. Only unanswered commands are resent.
+    /// @param errors If set, populated with each register's result, in order.
+    /// @return The error of the first register which failed, or None if every register was read.
+    Error readRegisters(Register* const* registersToRead, const size_t count, const bool retryOnFailure = true,
+                        Error* errors = nullptr) CONST_IF_THREADED noexcept;
+
+    /// @brief Writes several registers, keeping up to maxCommandsInFlight Write Register commands outstanding rather than waiting on each response in turn.
+    /// Writes are sent in order, but a resent write may reach the unit after later ones, so registers whose values depend on each other should not be
+    /// batched. Use changeBaudRate for the active serial port's baud rate.
+    /// @param registersToWrite The register objects to write to the unit.
+    /// @param count The number of registers to write.
+    /// @param retryOnFailure Whether to resend a command which is not answered within commandSendTimeoutLength. Only unanswered commands are resent.
+    /// @param errors If set, populated with each register's result, in order.
+    /// @return The error of the first register which failed, or None if every register was written.
+    Error writeRegisters(ConfigurationRegister* const* registersToWrite, const size_t count, const bool retryOnFailure = true,
+                         Error* errors = nullptr) CONST_IF_THREADED noexcept;
+
+    /// @brief Writes the register only if its value differs from the unit's. The unit's value is taken from the register cache if held there, otherwise read.
+    /// @param registerToWrite The register object to write to the unit.
+    /// @param written If set, populated with whether the register was written.
+    Error writeRegisterIfChanged(ConfigurationRegister* registerToWrite, bool* written = nullptr) CONST_IF_THREADED noexcept;
+
+    /// @brief Writes only the registers whose values differ from the unit's, then sends Write Settings if any register has been written since settings were
+    /// last written. Reads and writes are pipelined as in readRegisters and writeRegisters, and values held in the register cache are not read again.
+    /// @param registers The register objects holding the desired configuration.
+    /// @param count The number of registers.
+    /// @param saveToFlash Whether to send Write Settings. It is not sent if any register failed.
+    /// @return The first error encountered, or None if the unit holds every value.
+    Error applyConfiguration(ConfigurationRegister* const* registers, const size_t count, const bool saveToFlash = true) CONST_IF_THREADED noexcept;
+
+    /// @brief Forgets every value held in the register cache. Needed only if the unit is configured other than through this object, as the cache is
+    /// otherwise cleared on connecting, resetting and restoring factory settings.
+    void clearRegisterCache() noexcept;
+
     /// @brief Sends a Write Settings command to the unit and blocks on the unit's confirmation.
     Error writeSettings() CONST_IF_THREADED noexcept;
 
-    /// @brief Sends a Reset command to the unit and blocks on the unit's confirmation. After confirmation, it sleeps for resetSleepDuration and verifies sensor
-    /// connectivity, calling autoConnect if failed.
+    /// @brief Sends a Reset command to the unit and blocks on the unit's confirmation. After confirmation, it waits for the unit to start up, polling the Model
+    /// register with exponential backoff and returning as soon as it answers. If the unit has not answered within resetSleepDuration, calls autoConnect.
     Error reset() CONST_IF_THREADED noexcept;
 
-    /// @brief Sends a Restore Factory Settings command to the unit, blocks on the unit's confirmation, reopens serial at the unit's default baud rate, sleeps
-    /// for resetSleepDuration, then verifies unit connectivity. If THREADING_ENABLE, resets the Listening Thread.
+    /// @brief Sends a Restore Factory Settings command to the unit, blocks on the unit's confirmation, reopens serial at the unit's default baud rate, then
+    /// waits up to resetSleepDuration for the unit to start up and answer a Model register poll. If THREADING_ENABLE, resets the Listening Thread.
     Error restoreFactorySettings() noexcept;
 
     /// @brief Sends a Known Magnetic Distrubance command to the sensor and blocks on the unit's message confirmation.
@@ -198,6 +262,28 @@ public:
     Error sendCommand(Command* commandToSend, SendCommandBlockMode waitMode,
                       const Microseconds waitLength = Config::Sensor::commandSendTimeoutLength) CONST_IF_THREADED noexcept;
 
+    using CommandCompletion = CommandProcessor::CommandCompletion;
+
+    /// @brief Sends an arbitrary command to the unit without blocking. Timeouts and retries are handled by the listening thread if THREADING_ENABLE, and
+    /// otherwise by processAllPackets.
+    /// @param commandToSend The command object to send to the unit. Must outlive the call to onComplete.
+    /// @param onComplete Called exactly once with the command and its error response (None if it succeeded), or ResponseTimeout. If THREADING_ENABLE, it
+    /// is called on the listening thread. Not called if this returns an error.
+    /// @param waitMode BlockWithRetry resends the command commandSendRetriesAllowed times before completing with ResponseTimeout; otherwise it is sent once.
+    /// @param waitLength Duration to wait for each response before retrying or completing with ResponseTimeout.
+    Error sendCommandAsync(Command* commandToSend, CommandCompletion onComplete, SendCommandBlockMode waitMode = SendCommandBlockMode::BlockWithRetry,
+                           const Microseconds waitLength = Config::Sensor::commandSendTimeoutLength) noexcept;
+
+#if (THREADING_ENABLE)
+    /// @brief Sends an arbitrary command to the unit without blocking, returning a future fulfilled on the listening thread.
+    /// @param commandToSend The command object to send to the unit. Must outlive the future becoming ready.
+    /// @param waitMode BlockWithRetry resends the command commandSendRetriesAllowed times before completing with ResponseTimeout; otherwise it is sent once.
+    /// @param waitLength Duration to wait for each response before retrying or completing with ResponseTimeout.
+    /// @return The command's error response (None if it succeeded), ResponseTimeout, or the error which prevented sending it.
+    std::future<Error> sendCommandAsync(Command* commandToSend, SendCommandBlockMode waitMode = SendCommandBlockMode::BlockWithRetry,
+                                        const Microseconds waitLength = Config::Sensor::commandSendTimeoutLength) noexcept;
+#endif
+
     /// @brief Sends an arbitary message to the unit without any message modification or response validation. Not recommended for use.
     Error serialSend(const AsciiMessage& msgToSend) noexcept;
 
@@ -255,6 +341,44 @@ public:
     /// @param filter The filter from which to unsubscribe the passed queue.
     void unsubscribeFromMessage(PacketQueue_Interface* queueToUnsubscribe, const AsciiHeader& filter) noexcept;
 
+    /// @brief Registers a callable to be invoked with every matching measurement as soon as it is parsed, before it is placed on the MeasurementQueue. Multiple can be
+    /// simultaneously registered.
+    /// @details If THREADING_ENABLE, the callable is invoked on the listening thread, so it delays all further packet processing until it returns. The passed
+    /// CompositeData is only valid for the duration of the call, and the callable must not register or deregister measurement callbacks.
+    /// @param binaryOutputMeasurementFilter The filter to determine which binary measurements invoke the callable. Can be left empty.
+    /// @param callback The callable to invoke.
+    /// @param filterType How to interpret the respective binaryOutputMeasurementFilter.
+    Error registerMeasurementCallback(const BinaryOutputMeasurements& binaryOutputMeasurementFilter, MeasurementCallback callback,
+                                      const FaSubscriberFilterType filterType = FaSubscriberFilterType::ExactMatch) noexcept;
+
+    /// @brief Registers a callable to be invoked with every matching measurement as soon as it is parsed, before it is placed on the MeasurementQueue. Multiple can be
+    /// simultaneously registered.
+    /// @details If THREADING_ENABLE, the callable is invoked on the listening thread, so it delays all further packet processing until it returns. The passed
+    /// CompositeData is only valid for the duration of the call, and the callable must not register or deregister measurement callbacks.
+    /// @param asciiHeaderFilter The filter to determine which ASCII measurements invoke the callable. Can be left empty.
+    /// @param callback The callable to invoke.
+    /// @param filterType How to interpret the respective asciiHeaderFilter.
+    Error registerMeasurementCallback(const AsciiHeader& asciiHeaderFilter, MeasurementCallback callback,
+                                      const AsciiSubscriberFilterType filterType = AsciiSubscriberFilterType::StartsWith) noexcept;
+
+    /// @brief Deregisters all measurement callbacks matching the passed sync byte, regardless of filter.
+    /// @param syncByte The sync byte from which to deregister the callbacks.
+    void deregisterMeasurementCallbacks(const SyncByte syncByte) noexcept;
+
+    /// @brief Deregisters all measurement callbacks registered with the passed filter.
+    /// @param filter The filter from which to deregister the callbacks.
+    void deregisterMeasurementCallbacks(const BinaryOutputMeasurements& filter) noexcept;
+
+    /// @brief Deregisters all measurement callbacks registered with the passed filter.
+    /// @param filter The filter from which to deregister the callbacks.
+    void deregisterMeasurementCallbacks(const AsciiHeader& filter) noexcept;
+
+    /// @brief Limits which binary measurements are parsed into the CompositeData of the MeasurementQueue and measurement callbacks. The bytes of every
+    /// other field are skipped rather than decoded, and packets holding none of these measurements are not parsed at all. Subscribed queues still receive
+    /// whole packets.
+    /// @param measurementsToParse The measurements to parse. Can be left empty to parse every measurement enabled in Config.
+    void setMeasurementsToParse(const BinaryOutputMeasurements& measurementsToParse = BinaryOutputMeasurements{}) noexcept;
+
     // ------------------------------------------
     /*! @name Unthreaded Packet Processing */
     // ------------------------------------------
@@ -267,6 +391,11 @@ public:
     /// the lisening thread.
     /// @return Whether a packet has been processed.
     bool processNextPacket() noexcept;
+
+    /// @brief Checks for, parses, and forwards every complete packet currently in the mainBuffer. If THREADING_ENABLE, this is called in loop by the
+    /// lisening thread.
+    /// @return The number of packets processed.
+    size_t processAllPackets() noexcept;
 #endif
 
     /// @brief This is only used for software integration testing.
@@ -289,12 +418,19 @@ private:
     ByteBuffer _mainByteBuffer{Config::PacketFinders::mainBufferCapacity};
     Serial _serial{_mainByteBuffer};
 
+    bool _hearsUnit(const Microseconds listenDuration) noexcept;
+    bool _awaitStartup(const Microseconds maxDuration) noexcept;
+
 #if (THREADING_ENABLE)
     std::atomic<bool> _listening = false;
     std::unique_ptr<Thread> _listeningThread = nullptr;
+    ThreadAttributes _listeningThreadAttributes;
+    Error _listeningThreadAttributesError = Error::None;  // Reported only when it changes, as the thread restarts at each baud rate autoConnect tries
     void _listen() noexcept;
+    Microseconds _listenWaitLength() const noexcept;
     Error loadMainBufferFromSerial() noexcept;
     bool processNextPacket() noexcept;
+    size_t processAllPackets() noexcept;
     void _startListening() noexcept;
     void _stopListening() noexcept;
 #endif
@@ -303,13 +439,33 @@ private:
     // Measurement Operators
     // -------------------------------
     MeasurementQueue _measurementQueue{Config::PacketDispatchers::compositeDataQueueCapacity};
-    Sensor::CompositeDataQueueReturn _blockOnMeasurement(Timer& timer, const Microseconds sleepLength) CONST_IF_THREADED noexcept;
+    Sensor::CompositeDataQueueReturn _blockOnMeasurement(const Microseconds timeout) CONST_IF_THREADED noexcept;
 
     //-------------------------------
     // Command Operators
     //-------------------------------
-    CommandProcessor _commandProcessor{[this](AsyncError&& error) { _asyncErrorQueue.put(std::move(error)); }};
-    Error _blockOnCommand(Command* commandToWait, Timer& timer) CONST_IF_THREADED noexcept;
+    CommandProcessor _commandProcessor{[this](AsyncError&& error) { _asyncErrorQueue.put(std::move(error)); },
+                                       [this](const AsciiMessage& message) { return _serial.send(message); }};
+
+    // The unit's last known value of each configuration register read or written, keyed by its read command (e.g. "RRG,06,1") and held as formatted by
+    // toString, so values compare the same however the unit formats them.
+    struct CachedRegister
+    {
+        AsciiMessage address;
+        AsciiMessage value;
+    };
+    Vector<CachedRegister, Config::Sensor::registerCacheCapacity> _registerCache;
+    mutable Mutex _registerCacheMutex;
+    std::atomic<bool> _registersWrittenSinceSave = false;
+    std::optional<AsciiMessage> _cachedRegisterValue(const AsciiMessage& address) const noexcept;
+    void _cacheRegisterValue(const AsciiMessage& address, const AsciiMessage& value) noexcept;
+    void _registerRead(Register* registerRead) noexcept;
+    void _registerWritten(ConfigurationRegister* registerWritten, const Error error) noexcept;
+    Error _applyConfiguration(ConfigurationRegister* const* registers, const size_t count, size_t& numWritten) CONST_IF_THREADED noexcept;
+
+    template <class RegisterType>
+    Error _pipelineRegisterCommands(RegisterType* const* registers, const size_t count, Command (RegisterType::*toCommand)(), const bool retryOnFailure,
+                                    Error* errors) CONST_IF_THREADED noexcept;
 
     // -------------------------------
     // Packet Processing
@@ -335,6 +491,11 @@ Sensor::Sensor(std::array<uint8_t, MainByteBufferCapacity>& mainBuffer, std::arr
     _packetSynchronizer.addDispatcher(&_faPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_asciiPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_fbPacketDispatcher);
+
+    // Stamp packets with when the serial port received them
+    _faPacketDispatcher.setReceivedTimes(&_serial.receivedTimes());
+    _asciiPacketDispatcher.setReceivedTimes(&_serial.receivedTimes());
+    _fbPacketDispatcher.setReceivedTimes(&_serial.receivedTimes());
 }
 }  // namespace VN
 
@@ -59,7 +59,12 @@ public:
           _tail(other._head.load()),
           _head((other._head.load() + offset) % other._capacity),
           _size(other._size.load() - offset),
-          _autoAllocated(false) {};
+          _autoAllocated(false),
+          _readOnly(other._readOnly) {};
+
+    /// @brief A buffer over bytes which must not be written, e.g. a packet shared among subscribers. They can be read and discarded, but put and reserve
+    /// always fail.
+    static ByteBuffer readOnly(const uint8_t* buffer, const size_t size) noexcept { return ByteBuffer(buffer, size); }
 
     ~ByteBuffer()
     {
@@ -120,6 +125,7 @@ public:
 
     void reset()
     {
+        _numBytesDiscarded += _size;
         _size = 0;
         _head = 0;
         _tail = 0;
@@ -130,11 +136,14 @@ public:
 
     const uint8_t* peek_linear_unchecked(size_t offset) const { return &_buffer[_head + offset]; }
 
+    /// @brief Pointer to the byte at index, valid for numLinearBytes(index) bytes.
+    const uint8_t* peek_pointer_unchecked(const size_t index) const noexcept { return &_buffer[(_head + index) % _capacity]; }
+
     bool put(const uint8_t* inputBufferHead, size_t inputBufferSize) noexcept
     {
         if (inputBufferSize == 0) { return false; }
 
-        if (_full || (inputBufferSize > (_capacity - _size)))
+        if (_full || _readOnly || (inputBufferSize > (_capacity - _size)))
         {
             VN_DEBUG_1("Buffer overflow.");
             return true;
@@ -156,6 +165,49 @@ public:
         return false;
     }
 
+    /// @brief Writable linear regions of the free space, in the order they are to be filled. The second region is only non-empty if the free space wraps.
+    struct FreeSpans
+    {
+        uint8_t* first = nullptr;
+        size_t firstSize = 0;
+        uint8_t* second = nullptr;
+        size_t secondSize = 0;
+
+        size_t size() const noexcept { return firstSize + secondSize; }
+    };
+
+    /// @brief Exposes the free space so a producer can write into it directly, followed by a call to commit. Only one producer may reserve at a time.
+    FreeSpans reserve() const noexcept
+    {
+        FreeSpans spans;
+        if (_full || _readOnly) { return spans; }
+        const size_t tail = _tail;
+        const size_t numBytesFree = _capacity - _size;
+        spans.first = _buffer + tail;
+        spans.firstSize = std::min(_capacity - tail, numBytesFree);
+        spans.second = _buffer;
+        spans.secondSize = numBytesFree - spans.firstSize;
+        return spans;
+    }
+
+    /// @brief Makes numBytes previously written into the reserved spans available to readers.
+    bool commit(const size_t numBytes) noexcept
+    {
+        if (numBytes == 0) { return false; }
+        if (_full || (numBytes > (_capacity - _size)))
+        {
+            VN_DEBUG_1("Buffer overflow.");
+            return true;
+        }
+
+        _tail = (_tail + numBytes) % _capacity;
+        _full = _tail == _head;
+        _size += numBytes;
+
+        VN_DEBUG_2("committing bytes: " + std::to_string(numBytes));
+        return false;
+    }
+
     bool discard(const size_t numBytes) noexcept
     {
         if (numBytes == 0) { return false; }
@@ -163,6 +215,7 @@ public:
         _head = (_head + numBytes) % _capacity;
         _size -= numBytes;
         _full = false;
+        _numBytesDiscarded += numBytes;
         return false;
     }
 
@@ -216,8 +269,11 @@ public:
     bool isEmpty() const noexcept { return (!_full && (_tail == _head)); }
     bool isFull() const noexcept { return _full; }
     size_t capacity() const noexcept { return _capacity; }
+    /// @brief Bytes that have left the front of the buffer, including by reset. Adding the index of a byte gives its position in the stream through the
+    /// buffer, which is unaffected by wrapping.
+    uint64_t numBytesDiscarded() const noexcept { return _numBytesDiscarded; }
     size_t size() const noexcept { return _size; }
-    uint8_t* data() const noexcept { return _buffer; }
+    const uint8_t* data() const noexcept { return _buffer; }
     const uint8_t* head() const noexcept { return &_buffer[_head]; }
 
 #if (VN_DEBUG_LEVEL > 0)
@@ -237,6 +293,15 @@ private:
     std::atomic<size_t> _size = 0;
     std::atomic<bool> _full = false;
     bool _autoAllocated = true;
+    bool _readOnly = false;
+
+    uint64_t _numBytesDiscarded = 0;
+
+    // Only put and reserve write to the bytes, and both refuse to, so the bytes are never written through the pointer.
+    ByteBuffer(const uint8_t* buffer, const size_t size)
+        : _buffer(const_cast<uint8_t*>(buffer)), _capacity(size), _tail(0), _size(size), _full(true), _autoAllocated(false), _readOnly(true)
+    {
+    }
 
     constexpr const_iterator _begin() const noexcept { return _buffer; }
     const_iterator _end() const noexcept { return _begin() + _capacity; }
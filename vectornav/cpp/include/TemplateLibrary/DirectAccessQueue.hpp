@@ -28,6 +28,8 @@
 #include <array>
 #include <memory>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 #include "HAL/Mutex.hpp"
 #include "TemplateLibrary/Queue.hpp"
 
@@ -40,6 +42,17 @@ constexpr std::array<Type, sizeof...(Is)> initializeArray(int arg, std::index_se
     return {{(static_cast<void>(Is), Type(arg))...}};  // cast removes unused parameter warning
 }
 
+/// @brief Whether an item wants to be told when the queue frees it, e.g. to let go of a buffer it shares with items in other queues.
+template <class ItemType, class = void>
+struct HasOnFreed : std::false_type
+{
+};
+
+template <class ItemType>
+struct HasOnFreed<ItemType, std::void_t<decltype(std::declval<ItemType&>().onFreed())>> : std::true_type
+{
+};
+
 template <class ItemType>
 class DirectAccessQueue_Interface
 {
@@ -52,9 +65,12 @@ public:
             Free,
             Putting,
             Getting,
-            InQueue
+            InQueue,
+            Abandoned  // Was put, but never populated. Freed when it reaches the front of the queue.
         };
         std::atomic<Status> status = Status::Free;
+        DirectAccessQueue_Interface* owner = nullptr;  ///< If set, notified of every release rather than only having the status updated.
+        uint16_t index = 0;                            ///< Position within the owner's elements. Only used if owner is set.
 
         template <typename... ConstructArgs>
         Element(ConstructArgs&&... args) : item(std::forward<ConstructArgs>(args)...)
@@ -107,6 +123,13 @@ public:
 
         ItemType* get() const noexcept { return &_element->item; }
 
+        /// @brief Gives up an element obtained from put without publishing it to consumers, e.g. if populating it failed.
+        void abandon() noexcept
+        {
+            if (_element && (_element->status == Element::Status::Putting)) { _release(Element::Status::Abandoned); }
+            _element = nullptr;
+        }
+
         ItemType& operator*() { return _element->item; }
         const ItemType& operator*() const { return _element->item; }
 
@@ -118,8 +141,18 @@ public:
         {
             if (_element)
             {
-                if (_element->status == Element::Status::Getting) { _element->status = Element::Status::Free; }
-                else if (_element->status == Element::Status::Putting) { _element->status = Element::Status::InQueue; }
+                if (_element->status == Element::Status::Getting) { _release(Element::Status::Free); }
+                else if (_element->status == Element::Status::Putting) { _release(Element::Status::InQueue); }
+            }
+        }
+
+        void _release(const typename Element::Status newStatus)
+        {
+            if (_element->owner) { _element->owner->_onRelease(*_element, newStatus); }
+            else
+            {
+                if (newStatus != Element::Status::InQueue) { _onFreed(_element->item); }
+                _element->status = newStatus;
             }
         }
         DirectAccessQueue_Interface::Element* _element = nullptr;
@@ -133,6 +166,17 @@ public:
     virtual uint16_t size() const noexcept = 0;
     virtual bool isEmpty() const noexcept = 0;
     virtual uint16_t capacity() const noexcept = 0;
+
+protected:
+    static void _onFreed([[maybe_unused]] ItemType& item) noexcept
+    {
+        if constexpr (HasOnFreed<ItemType>::value) { item.onFreed(); }
+    }
+
+    /// @brief Called when an OwningPtr lets go of an element whose owner is set.
+    /// @param element The element released.
+    /// @param newStatus Free if it was gotten, InQueue if it was put, or Abandoned if it was put but abandoned.
+    virtual void _onRelease([[maybe_unused]] Element& element, [[maybe_unused]] const typename Element::Status newStatus) noexcept {}
 };
 
 template <class ItemType, size_t Capacity>
@@ -161,6 +205,7 @@ public:
     virtual OwningPtr put() noexcept override final
     {
         LockGuard lock(_mutex);
+        _freeAbandonedAtFront();
         uint16_t i = 0;
         for (auto& element : _elements)
         {
@@ -200,6 +245,7 @@ public:
     virtual OwningPtr get() noexcept override final
     {
         LockGuard lock(_mutex);
+        _freeAbandonedAtFront();
         auto nextIdx = _circularBuffer.peek();
         if (!nextIdx.has_value()) { return nullptr; }
         if (_elements[nextIdx.value()].status != Element::Status::InQueue)
@@ -220,9 +266,10 @@ public:
         bool found = false;
         while (true)
         {
+            _freeAbandonedAtFront();
             auto nextIdx = _circularBuffer.peek();
             if (!nextIdx || (_elements[*nextIdx].status != Element::Status::InQueue)) { break; }
-            _elements[*nextIdx].status = Element::Status::Free;
+            if (found) { _free(_elements[latestIdx]); }
             _circularBuffer.get();
             latestIdx = *nextIdx;
             found = true;
@@ -232,6 +279,25 @@ public:
         return &_elements[latestIdx];
     }
 
+    /// @brief Moves up to maxCount elements from the front of the queue into items, in order. Not virtual, so that queues of items which cannot be moved
+    /// still compile.
+    /// @return The number of elements moved.
+    uint16_t getMany(ItemType* items, const uint16_t maxCount) noexcept
+    {
+        LockGuard lock(_mutex);
+        uint16_t count = 0;
+        while (count < maxCount)
+        {
+            _freeAbandonedAtFront();
+            auto nextIdx = _circularBuffer.peek();
+            if (!nextIdx || (_elements[*nextIdx].status != Element::Status::InQueue)) { break; }
+            _circularBuffer.get();
+            items[count++] = std::move(_elements[*nextIdx].item);
+            _free(_elements[*nextIdx]);
+        }
+        return count;
+    }
+
     virtual uint16_t size() const noexcept override final
     {
         LockGuard lock(_mutex);
@@ -239,7 +305,7 @@ public:
 
         for (const auto& element : _elements)
         {
-            if (element.status == Element::Status::Putting) { --queueSize; }
+            if ((element.status == Element::Status::Putting) || (element.status == Element::Status::Abandoned)) { --queueSize; }
         }
         return queueSize;
     }
@@ -253,15 +319,32 @@ private:
     Queue<uint16_t, Capacity> _circularBuffer;
     mutable Mutex _mutex;
 
+    void _free(Element& element) noexcept
+    {
+        this->_onFreed(element.item);
+        element.status = Element::Status::Free;
+    }
+
+    void _freeAbandonedAtFront() noexcept
+    {
+        while (true)
+        {
+            auto nextIdx = _circularBuffer.peek();
+            if (!nextIdx.has_value() || (_elements[*nextIdx].status != Element::Status::Abandoned)) { break; }
+            _circularBuffer.get();  // Pop it from queue
+            _free(_elements[*nextIdx]);
+        }
+    }
+
     void _reset() noexcept
     {
         while (true)
         {
             auto nextIdx = _circularBuffer.peek();
-            if (nextIdx.has_value() && (_elements[*nextIdx].status == Element::Status::InQueue))
+            if (nextIdx.has_value() && ((_elements[*nextIdx].status == Element::Status::InQueue) || (_elements[*nextIdx].status == Element::Status::Abandoned)))
             {
                 _circularBuffer.get();  // Pop it from queue
-                _elements[*nextIdx].status = Element::Status::Free;
+                _free(_elements[*nextIdx]);
             }
             else
             {
@@ -0,0 +1,393 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef TEMPLATELIBRARY_LOCKFREEDIRECTACCESSQUEUE_HPP
+#define TEMPLATELIBRARY_LOCKFREEDIRECTACCESSQUEUE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include "HAL/ConditionVariable.hpp"
+#include "HAL/Timer.hpp"
+#include "TemplateLibrary/DirectAccessQueue.hpp"
+
+namespace VN
+{
+
+constexpr size_t cacheLineSize = 64;
+
+/// @brief A bounded ring of element indices, after Vyukov's bounded MPMC queue. Each side only pays for atomic read-modify-writes if it is shared.
+template <size_t Capacity, bool MultiProducer, bool MultiConsumer>
+class IndexRing
+{
+    static constexpr size_t _size = [] {
+        size_t size = 1;
+        while (size < Capacity) { size <<= 1; }
+        return size;
+    }();
+    static constexpr size_t _mask = _size - 1;
+
+public:
+    IndexRing() noexcept
+    {
+        for (size_t i = 0; i < _size; ++i) { _cells[i].sequence.store(i, std::memory_order_relaxed); }
+    }
+
+    /// @return True if the ring is full.
+    bool put(const uint16_t value) noexcept
+    {
+        size_t position = _putPosition.value.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true)
+        {
+            cell = &_cells[position & _mask];
+            const intptr_t difference = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position);
+            if (difference == 0)
+            {
+                if constexpr (MultiProducer)
+                {
+                    if (_putPosition.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; }
+                }
+                else
+                {
+                    _putPosition.value.store(position + 1, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            else if (difference < 0) { return true; }
+            else { position = _putPosition.value.load(std::memory_order_relaxed); }
+        }
+        cell->value = value;
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return false;
+    }
+
+    /// @return True if the ring is empty.
+    bool get(uint16_t& value) noexcept
+    {
+        size_t position = _getPosition.value.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true)
+        {
+            cell = &_cells[position & _mask];
+            const intptr_t difference = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position + 1);
+            if (difference == 0)
+            {
+                if constexpr (MultiConsumer)
+                {
+                    if (_getPosition.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; }
+                }
+                else
+                {
+                    _getPosition.value.store(position + 1, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            else if (difference < 0) { return true; }
+            else { position = _getPosition.value.load(std::memory_order_relaxed); }
+        }
+        value = cell->value;
+        cell->sequence.store(position + _mask + 1, std::memory_order_release);
+        return false;
+    }
+
+    /// @brief Puts every one of the values with a single claim on the ring.
+    /// @return True if the ring does not have room for all of them, in which case none are put.
+    bool put(const uint16_t* values, const size_t count) noexcept
+    {
+        if (count == 0) { return false; }
+        size_t position = _putPosition.value.load(std::memory_order_relaxed);
+        while (true)
+        {
+            intptr_t difference = 0;
+            for (size_t i = 0; (i < count) && (difference == 0); ++i)
+            {
+                difference = static_cast<intptr_t>(_cells[(position + i) & _mask].sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position + i);
+            }
+            if (difference == 0)
+            {
+                if constexpr (MultiProducer)
+                {
+                    if (_putPosition.value.compare_exchange_weak(position, position + count, std::memory_order_relaxed)) { break; }
+                }
+                else
+                {
+                    _putPosition.value.store(position + count, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            else if (difference < 0) { return true; }
+            else { position = _putPosition.value.load(std::memory_order_relaxed); }
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            Cell& cell = _cells[(position + i) & _mask];
+            cell.value = values[i];
+            cell.sequence.store(position + i + 1, std::memory_order_release);
+        }
+        return false;
+    }
+
+    /// @brief Gets up to maxCount values with a single claim on the ring.
+    /// @return The number of values gotten.
+    size_t get(uint16_t* values, const size_t maxCount) noexcept
+    {
+        if (maxCount == 0) { return 0; }
+        size_t position = _getPosition.value.load(std::memory_order_relaxed);
+        size_t count;
+        while (true)
+        {
+            count = 0;
+            intptr_t difference = 0;
+            while (count < maxCount)
+            {
+                difference = static_cast<intptr_t>(_cells[(position + count) & _mask].sequence.load(std::memory_order_acquire)) -
+                             static_cast<intptr_t>(position + count + 1);
+                if (difference != 0) { break; }
+                ++count;
+            }
+            if (count > 0)
+            {
+                if constexpr (MultiConsumer)
+                {
+                    if (_getPosition.value.compare_exchange_weak(position, position + count, std::memory_order_relaxed)) { break; }
+                }
+                else
+                {
+                    _getPosition.value.store(position + count, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            else if (difference < 0) { return 0; }
+            else { position = _getPosition.value.load(std::memory_order_relaxed); }
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            Cell& cell = _cells[(position + i) & _mask];
+            values[i] = cell.value;
+            cell.sequence.store(position + i + _mask + 1, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /// @brief The number of values in the ring. Only a snapshot while other threads are using it.
+    size_t size() const noexcept
+    {
+        const size_t getPosition = _getPosition.value.load(std::memory_order_acquire);
+        const size_t putPosition = _putPosition.value.load(std::memory_order_acquire);
+        return (putPosition > getPosition) ? (putPosition - getPosition) : 0;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        uint16_t value;
+    };
+
+    struct alignas(cacheLineSize) PaddedPosition
+    {
+        std::atomic<size_t> value{0};
+    };
+
+    PaddedPosition _putPosition;
+    PaddedPosition _getPosition;
+    alignas(cacheLineSize) std::array<Cell, _size> _cells;
+};
+
+/// @brief A DirectAccessQueue which never locks, with O(1) put, get and size.
+/// Element indices move between a ring of free elements and a ring of queued elements; OwningPtr returns each element to the right ring on release.
+/// Any number of threads may get. By default only one thread may put, which lets put avoid compare-exchange loops; set MultiProducer to allow several.
+/// As with DirectAccessQueue, putting into a full queue drops the oldest queued element. Consumers may also sleep until an element is put.
+template <class ItemType, size_t Capacity, bool MultiProducer = false>
+class LockFreeDirectAccessQueue : public DirectAccessQueue_Interface<ItemType>
+{
+    static_assert(Capacity <= UINT16_MAX);
+
+public:
+    using OwningPtr = typename DirectAccessQueue_Interface<ItemType>::OwningPtr;
+    using Element = typename DirectAccessQueue_Interface<ItemType>::Element;
+    using Status = typename Element::Status;
+
+    template <typename... Args>
+    LockFreeDirectAccessQueue(Args&&... args) : _elements{std::forward<Args>(args)...}
+    {
+        _initialize();
+    }
+
+    // Used for array initialization of a single value
+    template <class CArg>
+    LockFreeDirectAccessQueue(CArg&& arg) : _elements(initializeArray<PaddedElement>(arg, std::make_index_sequence<Capacity>{}))
+    {
+        _initialize();
+    }
+
+    LockFreeDirectAccessQueue(LockFreeDirectAccessQueue&& other) = delete;
+    LockFreeDirectAccessQueue(const LockFreeDirectAccessQueue& other) = delete;
+    LockFreeDirectAccessQueue& operator=(LockFreeDirectAccessQueue&& other) = delete;
+    LockFreeDirectAccessQueue& operator=(const LockFreeDirectAccessQueue& other) = delete;
+
+    virtual OwningPtr put() noexcept override final
+    {
+        uint16_t index;
+        if (_free.get(index))
+        {
+            // Queue is totally full. Force push by taking over the oldest queued element.
+            if (_queued.get(index))
+            {
+                VN_DEBUG_2("Request put failed.");
+                return nullptr;  // Every element is held by a producer or consumer.
+            }
+        }
+        _elements[index].status.store(Status::Putting, std::memory_order_relaxed);
+        return &_elements[index];
+    }
+
+    virtual OwningPtr get() noexcept override final
+    {
+        uint16_t index;
+        if (_queued.get(index)) { return nullptr; }
+        _elements[index].status.store(Status::Getting, std::memory_order_relaxed);
+        return &_elements[index];
+    }
+
+    virtual OwningPtr getBack() noexcept override final
+    {
+        uint16_t index;
+        if (_queued.get(index)) { return nullptr; }
+        uint16_t newerIndex;
+        while (!_queued.get(newerIndex))
+        {
+            _freeElement(index);
+            index = newerIndex;
+        }
+        _elements[index].status.store(Status::Getting, std::memory_order_relaxed);
+        return &_elements[index];
+    }
+
+    /// @brief Moves up to maxCount elements from the front of the queue into items, claiming all of them at once.
+    uint16_t getMany(ItemType* items, const uint16_t maxCount) noexcept
+    {
+        std::array<uint16_t, Capacity> indices;
+        const size_t count = _queued.get(indices.data(), std::min<size_t>(maxCount, Capacity));
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto& element = _elements[indices[i]];
+            items[i] = std::move(element.item);
+            this->_onFreed(element.item);
+            element.status.store(Status::Free, std::memory_order_relaxed);
+        }
+        _free.put(indices.data(), count);  // Cannot fail, as the ring holds every element
+        return static_cast<uint16_t>(count);
+    }
+
+    /// @brief Gets the front of the queue, sleeping until an element is put if the queue is empty.
+    /// @param timeout The maximum time to wait.
+    OwningPtr get(const Microseconds timeout) noexcept
+    {
+        return _waitFor(timeout, [this]() { return get(); });
+    }
+
+    /// @brief Gets the back of the queue, popping every element, sleeping until an element is put if the queue is empty.
+    /// @param timeout The maximum time to wait.
+    OwningPtr getBack(const Microseconds timeout) noexcept
+    {
+        return _waitFor(timeout, [this]() { return getBack(); });
+    }
+
+    virtual void reset() noexcept override final
+    {
+        uint16_t index;
+        while (!_queued.get(index)) { _freeElement(index); }
+    }
+
+    virtual uint16_t size() const noexcept override final { return static_cast<uint16_t>(_queued.size()); }
+
+    virtual bool isEmpty() const noexcept override final { return size() == 0; }
+
+    virtual uint16_t capacity() const noexcept override final { return Capacity; }
+
+private:
+    // Keeps producer writes to one element from invalidating the cache line a consumer is reading from the next.
+    struct alignas(cacheLineSize) PaddedElement : public Element
+    {
+        using Element::Element;
+    };
+
+    std::array<PaddedElement, Capacity> _elements;
+    IndexRing<Capacity, true, MultiProducer> _free;  // Released by any consumer, taken by the producer(s).
+    IndexRing<Capacity, MultiProducer, true> _queued;  // Published by the producer(s), taken by any consumer (or a producer forcing a put).
+    ConditionVariable _published;
+
+    void _initialize() noexcept
+    {
+        for (uint16_t i = 0; i < Capacity; ++i)
+        {
+            _elements[i].owner = this;
+            _elements[i].index = i;
+            _free.put(i);
+        }
+    }
+
+    template <class Getter>
+    OwningPtr _waitFor(const Microseconds timeout, Getter&& getter) noexcept
+    {
+        const time_point deadline = now() + timeout;
+        while (true)
+        {
+            // Read the generation before looking, so an element put in between cuts the wait short.
+            const uint32_t generation = _published.generation();
+            OwningPtr element = getter();
+            if (element) { return element; }
+
+            const auto remaining = deadline - now();
+            if (remaining <= Microseconds::zero()) { return nullptr; }
+            if (_published.waitFor(generation, std::chrono::ceil<Microseconds>(remaining))) { return getter(); }
+        }
+    }
+
+    void _freeElement(const uint16_t index) noexcept
+    {
+        this->_onFreed(_elements[index].item);
+        _elements[index].status.store(Status::Free, std::memory_order_relaxed);
+        _free.put(index);  // Cannot fail, as the ring holds every element
+    }
+
+    virtual void _onRelease(Element& element, const Status newStatus) noexcept override final
+    {
+        if (newStatus == Status::InQueue)
+        {
+            element.status.store(Status::InQueue, std::memory_order_relaxed);
+            _queued.put(element.index);  // Cannot fail, as the ring holds every element
+            _published.notifyAll();
+        }
+        else { _freeElement(element.index); }  // Gotten or abandoned
+    }
+};
+
+}  // namespace VN
+
+#endif  // TEMPLATELIBRARY_LOCKFREEDIRECTACCESSQUEUE_HPP
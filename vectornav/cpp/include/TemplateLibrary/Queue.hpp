@@ -104,6 +104,22 @@ public:
             _tail = (_tail + Capacity - 1) % Capacity;
         }
     }
+
+    /// @brief Removes the first item equal to the passed item, keeping the rest in order.
+    /// @return True if no item matched.
+    bool remove(const ItemType& item) noexcept
+    {
+        const uint16_t count = size();
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            if (!(_buffer[(_head + i) % Capacity] == item)) { continue; }
+            for (uint16_t j = i; j + 1 < count; ++j) { _buffer[(_head + j) % Capacity] = std::move(_buffer[(_head + j + 1) % Capacity]); }
+            popBack();
+            return false;
+        }
+        return true;
+    }
+
     using value_type = std::optional<ItemType>;  // Used to be able to arbitrate away implementation in Sensor
 private:
     std::array<ItemType, Capacity> _buffer;
@@ -176,6 +192,12 @@ public:
         LockGuard lock(_mutex);
         Base::popBack();
     }
+
+    bool remove(const ItemType& item) noexcept
+    {
+        LockGuard lock(_mutex);
+        return Base::remove(item);
+    }
     using value_type = std::optional<ItemType>;  // Used to be able to arbitrate away implementation in Sensor
 private:
     mutable Mutex _mutex;
@@ -309,39 +309,110 @@ namespace StringUtils
 // Numeric Conversions
 // ###################
 
+/// @brief Parses the fixed formats VectorNav units output, e.g. "+123.456" or "-1.234567E+02", without the locale or the general algorithm. Only values
+/// whose digits and power of ten are both exact in a double are accepted, so that a single multiply or divide rounds exactly as from_chars would. Anything
+/// else is left to the general parser.
 template <class T>
-std::optional<T> fromString(const char* begin, const char* end)
+std::optional<T> fromStringFixedFormat(const char* begin, const char* end) noexcept
 {
-    static_assert(std::is_arithmetic<T>::value, "Template parameter T must be a numeric type");
-    T numReturn;
-    if (*begin == '+') { begin++; }
-    auto [ptr, ec] = std::from_chars(begin, end, numReturn);
-    if (ptr != end || ec != std::errc{}) { return std::nullopt; }
-    return std::make_optional(numReturn);
+    static_assert(std::is_floating_point<T>::value);
+    constexpr uint64_t maxExactMantissa = uint64_t(1) << std::numeric_limits<double>::digits;
+    constexpr int maxExactPowerOfTen = 22;
+    constexpr double powersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const auto isDigit = [](const char c) { return static_cast<uint8_t>(c - '0') < 10; };
+
+    const char* itr = begin;
+    bool isNegative = false;
+    if ((itr != end) && ((*itr == '+') || (*itr == '-'))) { isNegative = (*itr++ == '-'); }
+
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    int numDigits = 0;
+    for (; (itr != end) && isDigit(*itr); ++itr, ++numDigits) { mantissa = mantissa * 10 + static_cast<uint8_t>(*itr - '0'); }
+    if ((itr != end) && (*itr == '.'))
+    {
+        for (++itr; (itr != end) && isDigit(*itr); ++itr, ++numDigits, --exponent) { mantissa = mantissa * 10 + static_cast<uint8_t>(*itr - '0'); }
+    }
+    if ((numDigits == 0) || (numDigits > std::numeric_limits<uint64_t>::digits10)) { return std::nullopt; }
+
+    if ((itr != end) && ((*itr == 'E') || (*itr == 'e')))
+    {
+        ++itr;
+        bool isExponentNegative = false;
+        if ((itr != end) && ((*itr == '+') || (*itr == '-'))) { isExponentNegative = (*itr++ == '-'); }
+        int writtenExponent = 0;
+        int numExponentDigits = 0;
+        for (; (itr != end) && isDigit(*itr) && (numExponentDigits < 3); ++itr, ++numExponentDigits) { writtenExponent = writtenExponent * 10 + (*itr - '0'); }
+        if (numExponentDigits == 0) { return std::nullopt; }
+        exponent += isExponentNegative ? -writtenExponent : writtenExponent;
+    }
+    if (itr != end) { return std::nullopt; }
+    if ((mantissa > maxExactMantissa) || (exponent < -maxExactPowerOfTen) || (exponent > maxExactPowerOfTen)) { return std::nullopt; }
+
+    double value = static_cast<double>(mantissa);
+    value = (exponent < 0) ? (value / powersOfTen[-exponent]) : (value * powersOfTen[exponent]);
+    if constexpr (std::is_same<T, float>::value)
+    {
+        // The double is correctly rounded, so narrowing it rounds as the decimal would unless it sits exactly halfway between two floats.
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        constexpr int droppedBits = std::numeric_limits<double>::digits - std::numeric_limits<float>::digits;
+        constexpr uint64_t droppedMask = (uint64_t(1) << droppedBits) - 1;
+        if ((bits & droppedMask) == (uint64_t(1) << (droppedBits - 1))) { return std::nullopt; }
+    }
+    const T narrowed = static_cast<T>(value);
+    return std::make_optional(isNegative ? -narrowed : narrowed);
 }
 
+/// @brief Parses any number from_chars accepts, after an optional leading '+', as fromString did before it tried the fixed formats first. Only worth
+/// calling directly to compare against fromString.
 #if (defined(__clang__) && __clang_major < 16) || defined(_MSC_VER) || (defined(__GNUC__) && __GNUC__ < 11)
-template <>
-inline std::optional<double> fromString(const char* begin, const char* end)
+// Without floating point from_chars, so the few values outside the fixed formats fall back to the locale-aware strtod.
+template <class T>
+std::optional<T> fromStringGeneral(const char* begin, const char* end)
 {
-    char* endPtr;
-    errno = 0;
-    const double numReturn = strtod(begin, &endPtr);
-    if (endPtr != end || errno == ERANGE) { return std::nullopt; }
-    return std::make_optional(numReturn);
+    if constexpr (std::is_floating_point<T>::value)
+    {
+        char* endPtr;
+        errno = 0;
+        const T numReturn = std::is_same<T, float>::value ? strtof(begin, &endPtr) : strtod(begin, &endPtr);
+        if (endPtr != end || errno == ERANGE) { return std::nullopt; }
+        return std::make_optional(numReturn);
+    }
+    else
+    {
+        T numReturn;
+        if (*begin == '+') { begin++; }
+        auto [ptr, ec] = std::from_chars(begin, end, numReturn);
+        if (ptr != end || ec != std::errc{}) { return std::nullopt; }
+        return std::make_optional(numReturn);
+    }
 }
-
-template <>
-inline std::optional<float> fromString(const char* begin, const char* end)
+#else
+template <class T>
+std::optional<T> fromStringGeneral(const char* begin, const char* end)
 {
-    char* endPtr;
-    errno = 0;
-    const float numReturn = strtof(begin, &endPtr);
-    if (endPtr != end || errno == ERANGE) { return std::nullopt; }
+    T numReturn;
+    if (*begin == '+') { begin++; }
+    auto [ptr, ec] = std::from_chars(begin, end, numReturn);
+    if (ptr != end || ec != std::errc{}) { return std::nullopt; }
     return std::make_optional(numReturn);
 }
 #endif
 
+template <class T>
+std::optional<T> fromString(const char* begin, const char* end)
+{
+    static_assert(std::is_arithmetic<T>::value, "Template parameter T must be a numeric type");
+    if constexpr (std::is_floating_point<T>::value)
+    {
+        const std::optional<T> fixedFormatValue = fromStringFixedFormat<T>(begin, end);
+        if (fixedFormatValue.has_value()) { return fixedFormatValue; }
+    }
+    return fromStringGeneral<T>(begin, end);
+}
+
 template <class T>
 std::optional<T> fromStringHex(const char* begin, const char* end)
 {
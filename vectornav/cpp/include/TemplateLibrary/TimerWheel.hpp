@@ -0,0 +1,142 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef TEMPLATELIBRARY_TIMERWHEEL_HPP
+#define TEMPLATELIBRARY_TIMERWHEEL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include "HAL/Duration.hpp"
+#include "HAL/Timer.hpp"
+
+namespace VN
+{
+
+/// @brief A hashed timing wheel of Capacity timers, each identified by its index. Scheduling and cancelling are O(1), and advancing only visits the slots
+/// of the ticks that have elapsed, regardless of how many timers are pending. Timers never expire early; they expire on the first advance at or after the
+/// tick following their deadline.
+template <uint16_t Capacity, uint16_t SlotCount>
+class TimerWheel
+{
+public:
+    using Id = uint16_t;
+
+    TimerWheel(const Microseconds tick, const time_point origin = now()) noexcept : _tick(tick), _origin(origin) { _slotHeads.fill(_none); }
+
+    /// @brief Schedules the timer to expire at deadline, replacing any previous deadline.
+    void schedule(const Id id, const time_point deadline) noexcept
+    {
+        cancel(id);
+        Timer& timer = _timers[id];
+        timer.expiryTick = std::max(_toTick(deadline, true), _currentTick + 1);
+        timer.scheduled = true;
+        const uint16_t slot = timer.expiryTick % SlotCount;
+        timer.previous = _none;
+        timer.next = _slotHeads[slot];
+        if (timer.next != _none) { _timers[timer.next].previous = id; }
+        _slotHeads[slot] = id;
+    }
+
+    /// @brief Stops the timer, if it is scheduled.
+    void cancel(const Id id) noexcept
+    {
+        Timer& timer = _timers[id];
+        if (!timer.scheduled) { return; }
+        if (timer.previous != _none) { _timers[timer.previous].next = timer.next; }
+        else { _slotHeads[timer.expiryTick % SlotCount] = timer.next; }
+        if (timer.next != _none) { _timers[timer.next].previous = timer.previous; }
+        timer.scheduled = false;
+    }
+
+    bool isScheduled(const Id id) const noexcept { return _timers[id].scheduled; }
+
+    /// @brief Expires every timer whose deadline has passed, calling onExpired with each of their ids. onExpired must not schedule or cancel timers.
+    template <class OnExpired>
+    void advance(const time_point currentTime, OnExpired&& onExpired) noexcept
+    {
+        const uint64_t targetTick = _toTick(currentTime, false);
+        if (targetTick <= _currentTick) { return; }
+        // Every slot holds timers for many revolutions, so a single lap covers any gap however long.
+        const uint64_t ticksToVisit = std::min<uint64_t>(targetTick - _currentTick, SlotCount);
+        for (uint64_t tick = _currentTick + 1; tick <= _currentTick + ticksToVisit; ++tick)
+        {
+            Id id = _slotHeads[tick % SlotCount];
+            while (id != _none)
+            {
+                const Id next = _timers[id].next;
+                if (_timers[id].expiryTick <= targetTick)
+                {
+                    cancel(id);
+                    onExpired(id);
+                }
+                id = next;
+            }
+        }
+        _currentTick = targetTick;
+    }
+
+    /// @brief The earliest deadline of any scheduled timer, if there is one.
+    std::optional<time_point> nextExpiry() const noexcept
+    {
+        std::optional<uint64_t> earliestTick;
+        for (const Timer& timer : _timers)
+        {
+            if (timer.scheduled && (!earliestTick.has_value() || (timer.expiryTick < *earliestTick))) { earliestTick = timer.expiryTick; }
+        }
+        if (!earliestTick.has_value()) { return std::nullopt; }
+        return _origin + _tick * static_cast<Microseconds::rep>(*earliestTick);
+    }
+
+private:
+    static constexpr Id _none = UINT16_MAX;
+    static_assert(Capacity < _none);
+
+    struct Timer
+    {
+        uint64_t expiryTick = 0;
+        Id previous = _none;
+        Id next = _none;
+        bool scheduled = false;
+    };
+
+    Microseconds _tick;
+    time_point _origin;
+    uint64_t _currentTick = 0;
+    std::array<Timer, Capacity> _timers{};
+    std::array<Id, SlotCount> _slotHeads;
+
+    uint64_t _toTick(const time_point time, const bool roundUp) const noexcept
+    {
+        if (time <= _origin) { return 0; }
+        const Microseconds elapsed = roundUp ? std::chrono::ceil<Microseconds>(time - _origin) : std::chrono::floor<Microseconds>(time - _origin);
+        const uint64_t ticks = static_cast<uint64_t>(elapsed / _tick);
+        return (roundUp && ((elapsed % _tick) != Microseconds::zero())) ? ticks + 1 : ticks;
+    }
+};
+
+}  // namespace VN
+
+#endif  // TEMPLATELIBRARY_TIMERWHEEL_HPP
@@ -41,6 +41,10 @@ namespace VN
 class Exporter
 {
 public:
+    /// @brief Gives each queued packet a buffer of its own, which it falls back on if the dispatcher's arena has no room for it, e.g. while other
+    /// subscribers hold on to different packets. Sized for the longest packet, so that no packet is dropped for lack of room.
+    Exporter() : Exporter(Config::PacketFinders::faPacketMaxLength) {}
+
     Exporter(const size_t& packetCapacity) : _queue{packetCapacity} {}
 
     virtual ~Exporter() {};
@@ -65,12 +69,19 @@ public:
 
     bool isLogging() const { return _logging; }
 
+    // Sets the scheduling policy, priority, CPU affinity and name of the running export thread. Returns the first attribute which could not be applied.
+    Error setThreadAttributes(const ThreadAttributes& attributes)
+    {
+        if (_thread == nullptr) { return Error::ThreadNotRunning; }
+        return _thread->setAttributes(attributes);
+    }
+
     PacketQueue_Interface* getQueuePtr() { return &_queue; }
 
 protected:
     std::atomic<bool> _logging = false;
     std::unique_ptr<Thread> _thread = nullptr;
-    PacketQueue<1000> _queue;
+    PacketQueue<Config::PacketDispatchers::packetSubscriberQueueCapacity> _queue;
 
 private:
     void _export()
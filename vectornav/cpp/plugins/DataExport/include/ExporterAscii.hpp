@@ -45,7 +45,7 @@ struct AsciiInfo
 class ExporterAscii : public Exporter
 {
 public:
-    ExporterAscii(const Filesystem::FilePath& outputDir) : Exporter(2048), _filePath(outputDir)
+    ExporterAscii(const Filesystem::FilePath& outputDir) : _filePath(outputDir)
     {
         if (!_filePath.empty() && _filePath.to_string().back() != std::filesystem::path::preferred_separator)
         {
@@ -69,7 +69,7 @@ public:
 
             OutputFile& ascii = getFileHandle(p->details.asciiMetadata.header);
 
-            ascii.write(reinterpret_cast<const char*>(p->buffer), p->details.asciiMetadata.length);
+            ascii.write(reinterpret_cast<const char*>(p->data()), p->details.asciiMetadata.length);
         }
     }
 
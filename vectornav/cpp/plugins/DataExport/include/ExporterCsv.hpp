@@ -57,7 +57,7 @@ class ExporterCsv : public Exporter
 {
 public:
     ExporterCsv(const Filesystem::FilePath& outputDir, bool enableSystemTimeStamps = false)
-        : Exporter(2048), _filePath(outputDir), _enableSystemTimeStamps(enableSystemTimeStamps)
+        : _filePath(outputDir), _enableSystemTimeStamps(enableSystemTimeStamps)
     {
         if (!_filePath.empty() && _filePath.to_string().back() != std::filesystem::path::preferred_separator)
         {
@@ -93,12 +93,12 @@ public:
                 const size_t begin = p->details.asciiMetadata.delimiterIndices.front() + 1;
                 const size_t end = p->details.asciiMetadata.delimiterIndices.back();
 
-                csv.write(reinterpret_cast<char*>(&p->buffer[begin]), end - begin);
+                csv.write(reinterpret_cast<const char*>(&p->data()[begin]), end - begin);
                 csv.write("\n", 1);
             }
             else
             {
-                FaPacketExtractor extractor(p->buffer, p->details.faMetadata);
+                FaPacketExtractor extractor(p->data(), p->details.faMetadata);
                 extractor.discard(p->details.faMetadata.header.size() + 1);
                 if (_enableSystemTimeStamps)
                 {
@@ -130,9 +130,10 @@ private:
             csvHeader.append(getMeasurementString(csvInfo.details.asciiMetadata.header));
             csvHeader += ",";
 
-            if (std::find(&p->buffer[7], &p->buffer[p->size], 'S') != &p->buffer[p->size]) { csvHeader += "appendStatus,"; }
+            const uint8_t* packetEnd = p->data() + p->size;
+            if (std::find(p->data() + 7, packetEnd, 'S') != packetEnd) { csvHeader += "appendStatus,"; }
 
-            if (std::find(&p->buffer[7], &p->buffer[p->size], 'T') != &p->buffer[p->size]) { csvHeader += "appendCount,"; }
+            if (std::find(p->data() + 7, packetEnd, 'T') != packetEnd) { csvHeader += "appendCount,"; }
         }
         else
         {
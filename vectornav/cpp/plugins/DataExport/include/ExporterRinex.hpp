@@ -52,7 +52,7 @@ static_assert((GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT) | (GNSS2_GROUP_ENABLE
 class ExporterRinex : public Exporter
 {
 public:
-    ExporterRinex(const Filesystem::FilePath& fileName, const uint32_t gnssGroup) : Exporter(2048), _fileName(fileName), _gnssGroup(gnssGroup)
+    ExporterRinex(const Filesystem::FilePath& fileName, const uint32_t gnssGroup) : _fileName(fileName), _gnssGroup(gnssGroup)
     {
         switch (gnssGroup)
         {
@@ -145,7 +145,7 @@ public:
 
             if (!p->details.faMetadata.header.contains(_gnssGroup, static_cast<uint32_t>(GNSS_GNSS1RAWMEAS_BIT))) { return; }
 
-            ByteBuffer byteBuffer(p->buffer, p->size, p->size);
+            const ByteBuffer byteBuffer = ByteBuffer::readOnly(p->data(), p->size);
 
             const auto cdOpt = FaPacketProtocol::parsePacket(byteBuffer, 0, p->details.faMetadata, Config::PacketDispatchers::cdEnabledMeasTypes);
             if (!cdOpt) return;
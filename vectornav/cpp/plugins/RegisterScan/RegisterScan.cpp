@@ -283,8 +283,9 @@ std::unique_ptr<VN::ConfigurationRegister> SensorConfigurator::GetRegisterByInde
 
 std::vector<std::unique_ptr<VN::ConfigurationRegister>> SensorConfigurator::registerScan()
 {
-    std::vector<std::unique_ptr<VN::ConfigurationRegister>> registers;
-
+    // Every candidate is polled twice, each pass with several reads in flight. A register id's candidates are kept only if every read succeeded.
+    std::vector<std::unique_ptr<VN::ConfigurationRegister>> candidates;
+    std::vector<size_t> candidatesEnd;  // One past each register id's last candidate
     for (const auto& [regId, factory] : RegScanFactory)
     {
         std::cout << "Polling register: " + std::to_string(regId) << std::endl;
@@ -296,11 +297,8 @@ std::vector<std::unique_ptr<VN::ConfigurationRegister>> SensorConfigurator::regi
             reg1->fromString("0,1");
             reg2->fromString("0,2");
 
-            if (sensor.readRegister(reg1.get()) == Error::None && sensor.readRegister(reg2.get()) == Error::None)
-            {
-                registers.push_back(std::move(reg1));
-                registers.push_back(std::move(reg2));
-            }
+            candidates.push_back(std::move(reg1));
+            candidates.push_back(std::move(reg2));
         }
         else if (regId == 99)
         {
@@ -311,24 +309,38 @@ std::vector<std::unique_ptr<VN::ConfigurationRegister>> SensorConfigurator::regi
             static_cast<GnssSystemConfig*>(reg1.get())->receiverSelect = GnssSystemConfig::ReceiverSelect::GnssA;
             static_cast<GnssSystemConfig*>(reg2.get())->receiverSelect = GnssSystemConfig::ReceiverSelect::GnssB;
 
-            if (sensor.readRegister(reg1.get()) == Error::None && sensor.readRegister(reg1.get()) == Error::None &&
-                sensor.readRegister(reg2.get()) == Error::None && sensor.readRegister(reg2.get()) == Error::None)
-            {
-                registers.push_back(std::move(reg1));
-                registers.push_back(std::move(reg2));
-            }
-            else
-            {
-                static_cast<GnssSystemConfig*>(reg1.get())->receiverSelect = GnssSystemConfig::ReceiverSelect::GnssAB;
-                if (sensor.readRegister(reg1.get()) == Error::None && sensor.readRegister(reg1.get()) == Error::None) { registers.push_back(std::move(reg1)); }
-            }
+            candidates.push_back(std::move(reg1));
+            candidates.push_back(std::move(reg2));
         }
-        else
-        {
-            auto reg = factory();
+        else { candidates.push_back(factory()); }
+        candidatesEnd.push_back(candidates.size());
+    }
+
+    std::vector<Register*> toRead;
+    for (const auto& candidate : candidates) { toRead.push_back(candidate.get()); }
+    std::vector<Error> firstErrors(toRead.size());
+    std::vector<Error> secondErrors(toRead.size());
+    sensor.readRegisters(toRead.data(), toRead.size(), true, firstErrors.data());
+    sensor.readRegisters(toRead.data(), toRead.size(), true, secondErrors.data());
 
+    std::vector<std::unique_ptr<VN::ConfigurationRegister>> registers;
+    size_t begin = 0;
+    for (const size_t end : candidatesEnd)
+    {
+        bool allRead = true;
+        for (size_t i = begin; i < end; ++i) { allRead &= (firstErrors[i] == Error::None) && (secondErrors[i] == Error::None); }
+        if (allRead)
+        {
+            for (size_t i = begin; i < end; ++i) { registers.push_back(std::move(candidates[i])); }
+        }
+        else if (candidates[begin]->id() == 99)
+        {
+            using Registers::GNSS::GnssSystemConfig;
+            auto& reg = candidates[begin];
+            static_cast<GnssSystemConfig*>(reg.get())->receiverSelect = GnssSystemConfig::ReceiverSelect::GnssAB;
             if (sensor.readRegister(reg.get()) == Error::None && sensor.readRegister(reg.get()) == Error::None) { registers.push_back(std::move(reg)); }
         }
+        begin = end;
     }
 
     return registers;
@@ -75,6 +75,13 @@ public:
     }
 
     bool isLogging() { return _logging; }
+
+    // Sets the scheduling policy, priority, CPU affinity and name of the running logging thread. Returns the first attribute which could not be applied.
+    Error setThreadAttributes(const ThreadAttributes& attributes)
+    {
+        if (_loggingThread == nullptr) { return Error::ThreadNotRunning; }
+        return _loggingThread->setAttributes(attributes);
+    }
     size_t bytesWritten = 0;
 
 protected:
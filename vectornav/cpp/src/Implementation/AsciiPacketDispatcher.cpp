@@ -30,7 +30,11 @@ namespace VN
 PacketDispatcher::FindPacketRetVal AsciiPacketDispatcher::findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
 {
     const AsciiPacketProtocol::FindPacketReturn findPacketRetVal = AsciiPacketProtocol::findPacket(byteBuffer, syncByteIndex);
-    if (findPacketRetVal.validity == AsciiPacketProtocol::Validity::Valid) { _latestPacketMetadata = findPacketRetVal.metadata; }
+    if (findPacketRetVal.validity == AsciiPacketProtocol::Validity::Valid)
+    {
+        _latestPacketMetadata = findPacketRetVal.metadata;
+        _latestPacketMetadata.timestamp = _packetReceivedTime(byteBuffer, syncByteIndex, findPacketRetVal.metadata.length);
+    }
     return {findPacketRetVal.validity, findPacketRetVal.metadata.length};
 }
 
@@ -46,7 +50,7 @@ void AsciiPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const s
             if (AsciiPacketProtocol::asciiIsParsable(asciiHeader))
             {
                 _invokeSubscribers(byteBuffer, syncByteIndex, _latestPacketMetadata);
-                if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity > 0)
+                if (Config::PacketDispatchers::compositeDataQueueCapacity > 0 || _hasMeasurementCallbacks.load())
                 {
                     packetHasBeenConsumed |= _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata, asciiHeader);
                 }
@@ -103,51 +107,105 @@ bool AsciiPacketDispatcher::_tryPushToCompositeDataQueue(const ByteBuffer& byteB
                                                          AsciiPacketProtocol::AsciiMeasurementHeader measEnum) noexcept
 {
     // if (!AsciiPacketProtocol::anyDataIsEnabled(metadata.header, _enabledMeasurements)) { return false; }
-    auto compositeData = AsciiPacketProtocol::parsePacket(byteBuffer, syncByteIndex, metadata, measEnum);
-    if (!compositeData.has_value()) { return false; }
+    if (Config::PacketDispatchers::compositeDataQueueCapacity > 0)
+    {
+        // Parse straight into the output queue's slot (or, if it is compact, the parse buffer), abandoning it if the packet turns out to be unparsable.
+        auto pMeasurement = _compositeDataQueue->put();
+        if (pMeasurement)
+        {
+            CompositeData& compositeData = measurementToParseInto(*pMeasurement, _measurementParseBuffer);
+            if (AsciiPacketProtocol::parsePacket(byteBuffer, syncByteIndex, metadata, measEnum, compositeData))
+            {
+                pMeasurement.abandon();
+                return false;
+            }
+            // Callbacks run while we still own the slot, so they see the measurement before any queue consumer can, without a copy.
+            if (_hasMeasurementCallbacks.load()) { _invokeMeasurementCallbacks(metadata.header, compositeData); }
+            storeParsedMeasurement(*pMeasurement, compositeData);
+            return true;
+        }
+    }
+    // There is nowhere to publish the measurement, but the callbacks still need it.
+    if (!_hasMeasurementCallbacks.load()) { return false; }
+    CompositeData compositeData;
+    if (AsciiPacketProtocol::parsePacket(byteBuffer, syncByteIndex, metadata, measEnum, compositeData)) { return false; }
+    _invokeMeasurementCallbacks(metadata.header, compositeData);
+    return false;
+}
 
-    // Copy to the output queue
-    auto pCompositeData = _compositeDataQueue->put();
-    if (!pCompositeData) { return false; }
-    *pCompositeData = compositeData.value();  // Todo 477: INvestigate passing pointer into the parser, rather than returning and copying it. Will that
-                                              // be more efficient than calling "reset" and assigning values?
-    return true;
+bool AsciiPacketDispatcher::addMeasurementCallback(MeasurementCallback callback, const AsciiHeader& headerToUse, SubscriberFilterType filterType) noexcept
+{
+    if (!callback) { return true; }
+    if (headerToUse.empty()) { filterType = SubscriberFilterType::StartsWith; }
+    LockGuard lock(_measurementCallbacksMutex);
+    const bool failed = _measurementCallbacks.push_back(MeasurementCallbackEntry{std::move(callback), headerToUse, filterType});
+    _hasMeasurementCallbacks.store(!_measurementCallbacks.empty());
+    return failed;
 }
 
-void AsciiPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata) noexcept
+void AsciiPacketDispatcher::removeMeasurementCallbacks() noexcept
 {
-    for (auto& subscriber : _subscribers)
+    LockGuard lock(_measurementCallbacksMutex);
+    for (auto& entry : _measurementCallbacks) { entry.callback = nullptr; }  // Release anything the callables captured
+    _measurementCallbacks.clear();
+    _hasMeasurementCallbacks.store(false);
+}
+
+void AsciiPacketDispatcher::removeMeasurementCallbacks(const AsciiHeader& headerToUse) noexcept
+{
+    LockGuard lock(_measurementCallbacksMutex);
+    for (size_t i = _measurementCallbacks.size(); i > 0; --i)
     {
-        if (StringUtils::startsWith(metadata.header, subscriber.headerFilter))
+        auto itr = _measurementCallbacks.begin() + (i - 1);
+        if (itr->headerFilter == headerToUse)
         {
-            if (subscriber.filterType == SubscriberFilterType::StartsWith)
-            {
-                [[maybe_unused]] const bool failed = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber);
-            }
+            itr->callback = nullptr;
+            _measurementCallbacks.erase(itr);
         }
-        else
+    }
+    _hasMeasurementCallbacks.store(!_measurementCallbacks.empty());
+}
+
+bool AsciiPacketDispatcher::_matchesFilter(const AsciiHeader& filterHeader, const SubscriberFilterType filterType, const AsciiHeader& packetHeader) noexcept
+{
+    const bool startsWith = StringUtils::startsWith(packetHeader, filterHeader);
+    return (filterType == SubscriberFilterType::StartsWith) ? startsWith : !startsWith;
+}
+
+void AsciiPacketDispatcher::_invokeMeasurementCallbacks(const AsciiHeader& packetHeader, const CompositeData& compositeData) noexcept
+{
+    LockGuard lock(_measurementCallbacksMutex);
+    for (const auto& entry : _measurementCallbacks)
+    {
+        if (_matchesFilter(entry.headerFilter, entry.filterType, packetHeader)) { entry.callback(compositeData); }
+    }
+}
+
+void AsciiPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata) noexcept
+{
+    SharedPacketBuffer sharedBuffer;  // Stored for the first subscriber, and shared with the rest
+    for (auto& subscriber : _subscribers)
+    {
+        if (_matchesFilter(subscriber.headerFilter, subscriber.filterType, metadata.header))
         {
-            if (subscriber.filterType == SubscriberFilterType::DoesNotStartWith)
-            {
-                [[maybe_unused]] const bool failed = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber);
-            }
+            [[maybe_unused]] const bool failed = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber, sharedBuffer);
         }
     }
 }
 
 bool AsciiPacketDispatcher::_tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
-                                                 Subscriber& subscriber) noexcept
+                                                 Subscriber& subscriber, SharedPacketBuffer& sharedBuffer) noexcept
 {
-    auto putSlot = subscriber.queueToPush->put();
+    if (!sharedBuffer) { sharedBuffer = _packetArena.store(byteBuffer, syncByteIndex, metadata.length); }
+    auto putSlot = putSubscriberPacket(subscriber.queueToPush, byteBuffer, syncByteIndex, metadata.length, sharedBuffer);
     if (putSlot)
     {
         putSlot->details.syncByte = PacketDetails::SyncByte::Ascii;
         putSlot->details.asciiMetadata = metadata;
-        byteBuffer.peek_unchecked(putSlot->buffer, metadata.length, syncByteIndex);
     }
     else
     {
-        // Putting failed
+        // Putting failed, or the arena was full and the slot had no buffer of its own
         return true;
     }
     return false;
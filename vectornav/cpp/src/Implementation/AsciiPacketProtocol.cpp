@@ -26,7 +26,10 @@
 
 #include "Config.hpp"
 #include "Interface/CompositeData.hpp"
+#include <array>
 #include <cstdint>
+#include <cstring>
+#include <initializer_list>
 #include "TemplateLibrary/String.hpp"
 #include "Implementation/CoreUtils.hpp"
 #include "HAL/Timer.hpp"
@@ -36,128 +39,259 @@ namespace VN
 {
 namespace AsciiPacketProtocol
 {
-// namespace {
 struct AsciiMeasurementIndices
 {
-    AsciiMeasurementIndices() {};
-    AsciiMeasurementIndices(uint8_t MeasGroupIndex, uint8_t MeasTypeIndex) : measGroupIndex(MeasGroupIndex), measTypeIndex(MeasTypeIndex) {};
     uint8_t measGroupIndex;
     uint8_t measTypeIndex;
 };
 
-std::optional<Vector<AsciiMeasurementIndices, 9>> _getAsciiMeasurementIndices(const AsciiMeasurementHeader asciiHeader);
-bool _parseAsciiMessage(const AsciiMeasurementHeader asciiHeader, const ByteBuffer& buffer, const size_t syncByteIdx, const Metadata& metadata,
-                        CompositeData& compositeData);
+using HeaderChars = std::array<char, 3>;
 
-using HeaderChars = std::array<char, 5>;
+/// @brief Everything needed to parse a measurement header, so that each packet resolves its header once and parses without building anything.
+struct AsciiMeasurementDescriptor
+{
+    AsciiMeasurementHeader header;
+    HeaderChars headerChars;
+    uint8_t numParameters;
+    uint8_t numMeasurements;
+    std::array<AsciiMeasurementIndices, 9> measurements;
+    EnabledMeasurements enabledMeasurements;
+
+    constexpr const AsciiMeasurementIndices* begin() const noexcept { return measurements.data(); }
+    constexpr const AsciiMeasurementIndices* end() const noexcept { return measurements.data() + numMeasurements; }
+};
 
-constexpr std::array<std::tuple<HeaderChars, AsciiMeasurementHeader>, 22> headerMapping = {
+constexpr AsciiMeasurementDescriptor _makeDescriptor(const AsciiMeasurementHeader header, const char (&headerChars)[4], const uint8_t numParameters,
+                                                     std::initializer_list<AsciiMeasurementIndices> measurements)
+{
+    AsciiMeasurementDescriptor descriptor{header, {headerChars[0], headerChars[1], headerChars[2]}, numParameters, 0, {}, {}};
+    for (const auto& measurement : measurements)
+    {
+        descriptor.measurements[descriptor.numMeasurements++] = measurement;
+        descriptor.enabledMeasurements[measurement.measGroupIndex - 1] |= 1u << measurement.measTypeIndex;  // Subtracting 1 because of Common group offset
+    }
+    return descriptor;
+}
 
-    std::make_tuple(HeaderChars{"YPR"}, AsciiMeasurementHeader::YPR), std::make_tuple(HeaderChars{"QTN"}, AsciiMeasurementHeader::QTN),
-    std::make_tuple(HeaderChars{"QMR"}, AsciiMeasurementHeader::QMR), std::make_tuple(HeaderChars{"MAG"}, AsciiMeasurementHeader::MAG),
-    std::make_tuple(HeaderChars{"ACC"}, AsciiMeasurementHeader::ACC), std::make_tuple(HeaderChars{"GYR"}, AsciiMeasurementHeader::GYR),
-    std::make_tuple(HeaderChars{"MAR"}, AsciiMeasurementHeader::MAR), std::make_tuple(HeaderChars{"YMR"}, AsciiMeasurementHeader::YMR),
-    std::make_tuple(HeaderChars{"YBA"}, AsciiMeasurementHeader::YBA), std::make_tuple(HeaderChars{"YIA"}, AsciiMeasurementHeader::YIA),
-    std::make_tuple(HeaderChars{"IMU"}, AsciiMeasurementHeader::IMU), std::make_tuple(HeaderChars{"GPS"}, AsciiMeasurementHeader::GPS),
-    std::make_tuple(HeaderChars{"GPE"}, AsciiMeasurementHeader::GPE), std::make_tuple(HeaderChars{"INS"}, AsciiMeasurementHeader::INS),
-    std::make_tuple(HeaderChars{"INE"}, AsciiMeasurementHeader::INE), std::make_tuple(HeaderChars{"ISL"}, AsciiMeasurementHeader::ISL),
-    std::make_tuple(HeaderChars{"ISE"}, AsciiMeasurementHeader::ISE), std::make_tuple(HeaderChars{"DTV"}, AsciiMeasurementHeader::DTV),
-    std::make_tuple(HeaderChars{"G2S"}, AsciiMeasurementHeader::G2S), std::make_tuple(HeaderChars{"G2E"}, AsciiMeasurementHeader::G2E),
-    std::make_tuple(HeaderChars{"HVE"}, AsciiMeasurementHeader::HVE), std::make_tuple(HeaderChars{"RTK"}, AsciiMeasurementHeader::RTK)};
+// Indexed by AsciiMeasurementHeader.
+constexpr std::array<AsciiMeasurementDescriptor, 23> measurementDescriptors = {
+    AsciiMeasurementDescriptor{AsciiMeasurementHeader::None, {}, 0, 0, {}, {}},
+    _makeDescriptor(AsciiMeasurementHeader::INS, "INS", 15,
+                    {
+                        {1, 2},   // GpsTow
+                        {1, 3},   // GpsWeek
+                        {5, 0},   // InsStatus
+                        {4, 1},   // Ypr
+                        {5, 1},   // PosLla
+                        {5, 4},   // VelNed
+                        {4, 13},  // AttU
+                        {5, 9},   // PosU
+                        {5, 10},  // VelU
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::YPR, "YPR", 3,
+                    {
+                        {4, 1},  // Ypr
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::QTN, "QTN", 4,
+                    {
+                        {4, 2},  // Quaternion
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::QMR, "QMR", 13,
+                    {
+                        {4, 2},   // Quaternion
+                        {2, 8},   // Mag
+                        {2, 9},   // Accel
+                        {2, 10},  // AngularRate
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::MAG, "MAG", 3,
+                    {
+                        {2, 8},  // Mag
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::ACC, "ACC", 3,
+                    {
+                        {2, 9},  // Accel
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::GYR, "GYR", 3,
+                    {
+                        {2, 10},  // AngularRate
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::MAR, "MAR", 9,
+                    {
+                        {2, 8},   // Mag
+                        {2, 9},   // Accel
+                        {2, 10},  // AngularRate
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::YMR, "YMR", 12,
+                    {
+                        {4, 1},   // Ypr
+                        {2, 8},   // Mag
+                        {2, 9},   // Accel
+                        {2, 10},  // AngularRate
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::YBA, "YBA", 9,
+                    {
+                        {4, 1},   // Ypr
+                        {4, 6},   // LinBodyAcc
+                        {2, 10},  // AngularRate
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::YIA, "YIA", 9,
+                    {
+                        {4, 1},   // Ypr
+                        {4, 7},   // LinAccelNed
+                        {2, 10},  // AngularRate
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::IMU, "IMU", 11,
+                    {
+                        {2, 1},  // UncompMag
+                        {2, 2},  // UncompAccel
+                        {2, 3},  // UncompGyro
+                        {2, 4},  // Temperature
+                        {2, 5},  // Pressure
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::GPS, "GPS", 15,
+                    {
+                        {3, 1},   // GpsTow
+                        {3, 2},   // GpsWeek
+                        {3, 4},   // GnssFix
+                        {3, 3},   // NumSats
+                        {3, 5},   // GnssPosLla
+                        {3, 7},   // GnssVelNed
+                        {3, 9},   // GnssPosUncertainty
+                        {3, 10},  // GnssVelUncertainty
+                        {3, 11},  // GnssTimeUncertainty
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::GPE, "GPE", 15,
+                    {
+                        {3, 1},   // GpsTow
+                        {3, 2},   // GpsWeek
+                        {3, 4},   // GnssFix
+                        {3, 3},   // NumSats
+                        {3, 6},   // GnssPosEcef
+                        {3, 8},   // GnssVelEcef
+                        {3, 9},   // GnssPosUncertaintyEcef
+                        {3, 10},  // GnssVelUncertainty
+                        {3, 11},  // GnssTimeUncertainty
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::INE, "INE", 15,
+                    {
+                        {1, 2},   // GpsTow
+                        {1, 3},   // GpsWeek
+                        {5, 0},   // InsStatus
+                        {4, 1},   // Ypr
+                        {5, 2},   // PosEcef
+                        {5, 5},   // VelEcef
+                        {4, 13},  // AttU
+                        {5, 9},   // PosU
+                        {5, 10},  // VelU
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::ISL, "ISL", 15,
+                    {
+                        {4, 1},   // Ypr
+                        {5, 1},   // PosLla
+                        {5, 4},   // VelNed
+                        {2, 9},   // Accel
+                        {2, 10},  // AngularRate
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::ISE, "ISE", 15,
+                    {
+                        {4, 1},   // Ypr
+                        {5, 2},   // PosEcef
+                        {5, 5},   // VelEcef
+                        {2, 9},   // Accel
+                        {2, 10},  // AngularRate
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::DTV, "DTV", 7,
+                    {
+                        {2, 6},  // DeltaTheta
+                        {2, 7},  // DeltaVel
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::G2S, "G2S", 15,
+                    {
+                        {6, 1},   // GpsTow
+                        {6, 2},   // GpsWeek
+                        {6, 4},   // GnssFix
+                        {6, 3},   // NumSats
+                        {6, 5},   // GnssPosLla
+                        {6, 7},   // GnssVelNed
+                        {6, 9},   // GnssPosUncertainty
+                        {6, 10},  // GnssVelUncertainty
+                        {6, 11},  // GnssTimeUncertainty
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::G2E, "G2E", 15,
+                    {
+                        {6, 1},   // GpsTow
+                        {6, 2},   // GpsWeek
+                        {6, 4},   // GnssFix
+                        {6, 3},   // NumSats
+                        {6, 6},   // GnssPosEcef
+                        {6, 8},   // GnssVelEcef
+                        {6, 9},   // GnssPosUncertaintyEcef
+                        {6, 10},  // GnssVelUncertainty
+                        {6, 11},  // GnssTimeUncertainty
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::HVE, "HVE", 3,
+                    {
+                        {4, 12},  // Heave
+                    }),
+    _makeDescriptor(AsciiMeasurementHeader::RTK, "RTK", 0, {}),  // Deprecated or unused measurements
+};
 
-uint8_t _getNumAsciiParameters(const AsciiMeasurementHeader header)
+constexpr bool _descriptorsAreInHeaderOrder()
 {
-    switch (header)
+    for (size_t i = 0; i < measurementDescriptors.size(); ++i)
     {
-        case AsciiMeasurementHeader::QTN:
-        {
-            return 4;
-        }
-        case AsciiMeasurementHeader::QMR:
-        {
-            return 13;
-        }
-        case AsciiMeasurementHeader::YPR:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::MAG:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ACC:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::HVE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::GYR:
-        {
-            return 3;
-        }
-        case AsciiMeasurementHeader::YMR:
-        {
-            return 12;
-        }
-        case AsciiMeasurementHeader::MAR:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::YBA:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::YIA:
-        {
-            return 9;
-        }
-        case AsciiMeasurementHeader::IMU:
-        {
-            return 11;
-        }
-        case AsciiMeasurementHeader::GPS:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::GPE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::G2S:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::G2E:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::INS:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::INE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ISL:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ISE:
-        {
-            return 15;
-        }
-        case AsciiMeasurementHeader::DTV:
-        {
-            return 7;
-        }
-        case AsciiMeasurementHeader::RTK:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::None:
-        {
-            return 0;
-        }
-        default:
-            return 0;
+        if (static_cast<size_t>(measurementDescriptors[i].header) != i) { return false; }
     }
+    return true;
 }
+static_assert(_descriptorsAreInHeaderOrder(), "measurementDescriptors must be indexed by AsciiMeasurementHeader.");
 
-AsciiMeasurementHeader getMeasHeader(AsciiHeader headerChars)
+// The constants were searched for offline so that every measurement header lands in its own slot, which the static_assert below verifies.
+constexpr size_t headerHashSlotCount = 64;
+constexpr size_t _hashHeaderChars(const char* headerChars) noexcept
+{
+    return (2 * static_cast<uint8_t>(headerChars[0]) + 63 * static_cast<uint8_t>(headerChars[1]) + static_cast<uint8_t>(headerChars[2])) % headerHashSlotCount;
+}
+
+constexpr std::array<AsciiMeasurementHeader, headerHashSlotCount> _buildHeaderHashSlots()
 {
-    for (const auto& mapEntry : headerMapping)
+    std::array<AsciiMeasurementHeader, headerHashSlotCount> slots{};  // Empty slots hold None
+    for (size_t i = 1; i < measurementDescriptors.size(); ++i)
     {
-        if (std::memcmp(headerChars.data() + 2, std::get<0>(mapEntry).data(), sizeof(char) * 3) == 0) { return std::get<1>(mapEntry); }
+        slots[_hashHeaderChars(measurementDescriptors[i].headerChars.data())] = measurementDescriptors[i].header;
     }
-    return AsciiMeasurementHeader::None;
+    return slots;
 }
+constexpr std::array<AsciiMeasurementHeader, headerHashSlotCount> headerHashSlots = _buildHeaderHashSlots();
 
-EnabledMeasurements asciiHeaderToMeasHeader(const AsciiMeasurementHeader header) noexcept
+constexpr bool _headerHashIsPerfect()
 {
-    EnabledMeasurements presentMeasurements = {};
-    auto asciiMeasurementIndices = _getAsciiMeasurementIndices(header).value();
-    for (const auto& currentMeasField : asciiMeasurementIndices)
+    for (size_t i = 1; i < measurementDescriptors.size(); ++i)
     {
-        VN_ASSERT((presentMeasurements.size() > static_cast<uint8_t>(currentMeasField.measGroupIndex - 1)));  // Subtructing 1 because of Common group offset
-        presentMeasurements.at(currentMeasField.measGroupIndex - 1) |= 1 << currentMeasField.measTypeIndex;   // Subtructing 1 because of Common group offset
+        if (headerHashSlots[_hashHeaderChars(measurementDescriptors[i].headerChars.data())] != measurementDescriptors[i].header) { return false; }
     }
-    return presentMeasurements;
-};
+    return true;
+}
+static_assert(_headerHashIsPerfect(), "Two measurement headers share a hash slot; the hash constants need to be searched for again.");
+
+const AsciiMeasurementDescriptor& _getDescriptor(const AsciiMeasurementHeader header) noexcept
+{
+    const size_t index = static_cast<size_t>(header);
+    return measurementDescriptors[(index < measurementDescriptors.size()) ? index : 0];
+}
+
+AsciiMeasurementHeader getMeasHeader(AsciiHeader headerChars)
+{
+    const char* measurementChars = headerChars.data() + 2;
+    const AsciiMeasurementDescriptor& candidate = _getDescriptor(headerHashSlots[_hashHeaderChars(measurementChars)]);
+    if ((candidate.header == AsciiMeasurementHeader::None) || (std::memcmp(measurementChars, candidate.headerChars.data(), candidate.headerChars.size()) != 0))
+    {
+        return AsciiMeasurementHeader::None;
+    }
+    return candidate.header;
+}
+
+EnabledMeasurements asciiHeaderToMeasHeader(const AsciiMeasurementHeader header) noexcept { return _getDescriptor(header).enabledMeasurements; }
 
 bool allDataIsEnabled(const AsciiMeasurementHeader header, const EnabledMeasurements& measurementsToCheck) noexcept
 {
@@ -171,12 +305,9 @@ bool allDataIsEnabled(const AsciiMeasurementHeader header, const EnabledMeasurem
     return (isEnabled);
 }
 
-bool asciiIsMeasurement(const AsciiMeasurementHeader header) noexcept { return _getAsciiMeasurementIndices(header).has_value(); }
+bool asciiIsMeasurement(const AsciiMeasurementHeader header) noexcept { return _getDescriptor(header).header != AsciiMeasurementHeader::None; }
 
-bool asciiIsParsable(const AsciiPacketProtocol::AsciiMeasurementHeader header) noexcept
-{
-    return (_getAsciiMeasurementIndices(header).has_value() && !_getAsciiMeasurementIndices(header).value().empty());
-}
+bool asciiIsParsable(const AsciiPacketProtocol::AsciiMeasurementHeader header) noexcept { return _getDescriptor(header).numMeasurements > 0; }
 
 bool anyDataIsEnabled(const AsciiMeasurementHeader header, const EnabledMeasurements& measurementsToCheck) noexcept
 {
@@ -201,7 +332,6 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
     Metadata details;
-    details.timestamp = now();
 
     auto tmpByte = byteBuffer.peek_unchecked(syncByteIndex);
     if (tmpByte != static_cast<uint8_t>('$')) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }  // It was a mistake to come here.
@@ -224,8 +354,7 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
     if (details.length > Config::PacketFinders::asciiPacketMaxLength) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
 
     bool processingHeader = true;
-    uint8_t checksum8 = 0;
-    uint16_t crc16 = 0;
+    size_t checksumEndIndex = details.length;  // The checksum covers everything between the sync byte and the asterisk
     for (size_t fromSyncByteIndex = 1; fromSyncByteIndex < details.length; ++fromSyncByteIndex)
     {                                                              // Beginning one after the sync byte, but mark it as checked
         size_t fromTailIndex = syncByteIndex + fromSyncByteIndex;  // Should be zero-based, but is relative to current absolute tail.
@@ -239,6 +368,7 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
         {
             details.delimiterIndices.push_back(fromSyncByteIndex);
             processingHeader = false;
+            checksumEndIndex = fromSyncByteIndex;
             break;
         }
         else if (((tmpByte < ' ') || (tmpByte > '~') || (tmpByte == '$')) && (tmpByte != '\r'))
@@ -251,8 +381,6 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
             if (fromSyncByteIndex > Config::PacketFinders::asciiHeaderMaxLength) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
             details.header.push_back(tmpByte);
         }
-        _calculateCheckSum(&checksum8, tmpByte);
-        _calculateCRC(&crc16, tmpByte);
     }
 
     const size_t bytesBetweenAstereskAndNewline = details.length - details.delimiterIndices.back();
@@ -261,12 +389,12 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
     if (bytesBetweenAstereskAndNewline == static_cast<size_t>(2 + 2 + 1 - isMissingCarriageReturn))
     {  // *, CRC1, CRC2, \r (if isMissingCarriageReturn = false) , \n
         crcLength = 2;
-        calculatedChecksum = checksum8;
+        calculatedChecksum = CalculateCheckSum(byteBuffer, syncByteIndex + 1, checksumEndIndex - 1);
     }
     else if (bytesBetweenAstereskAndNewline == static_cast<size_t>(4 + 2 + 1 - isMissingCarriageReturn))
     {  // *, CRC1, CRC2, CRC3, CRC4, \r (if isMissingCarriageReturn = false), \n
         crcLength = 4;
-        calculatedChecksum = crc16;
+        calculatedChecksum = CalculateCRC(byteBuffer, syncByteIndex + 1, checksumEndIndex - 1);
     }
     else if (bytesBetweenAstereskAndNewline == (0 + 2 + 1))
     {  // *, \r, \n
@@ -309,21 +437,29 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
 
 std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
                                          AsciiPacketProtocol::AsciiMeasurementHeader measEnum) noexcept
+{
+    CompositeData compositeData;
+    if (parsePacket(buffer, syncByteIndex, metadata, measEnum, compositeData)) { return std::nullopt; }
+    return std::make_optional(compositeData);
+}
+
+bool parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, AsciiPacketProtocol::AsciiMeasurementHeader measEnum,
+                 CompositeData& compositeData) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
 
-    const uint8_t numExpectedDelimeters = _getNumAsciiParameters(measEnum) + 1;
+    const AsciiMeasurementDescriptor& descriptor = _getDescriptor(measEnum);
+    const uint8_t numExpectedDelimeters = descriptor.numParameters + 1;
     // delimeters are wrong or there are too many appended messages
-    if (!(numExpectedDelimeters <= metadata.delimiterIndices.size() && metadata.delimiterIndices.size() - numExpectedDelimeters < 3)) { return std::nullopt; }
+    if (!(numExpectedDelimeters <= metadata.delimiterIndices.size() && metadata.delimiterIndices.size() - numExpectedDelimeters < 3)) { return true; }
 
-    CompositeData compositeData{metadata.header};
+    compositeData.reset(metadata.header);
+    compositeData.timestamp = metadata.timestamp;
     AsciiPacketExtractor extractor(buffer, metadata, syncByteIndex);
 
-    auto asciiParsingData = _getAsciiMeasurementIndices(measEnum).value();
-
-    for (const auto& measIndex : asciiParsingData)
+    for (const auto& measIndex : descriptor)
     {
-        if (compositeData.copyFromBuffer(extractor, measIndex.measGroupIndex, measIndex.measTypeIndex)) { return std::nullopt; }
+        if (compositeData.copyFromBuffer(extractor, measIndex.measGroupIndex, measIndex.measTypeIndex)) { return true; }
     }
 
     // append amount
@@ -334,231 +470,21 @@ std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t
         if (appendParam.value().at(0) == 'S')
         {
             compositeData.asciiAppendStatus = StringUtils::fromStringHex<uint16_t>(appendParam.value().begin() + 1, appendParam.value().end());
-            if (!compositeData.asciiAppendStatus.has_value()) { return std::nullopt; }
+            if (!compositeData.asciiAppendStatus.has_value()) { return true; }
             extractor.discard(1);
         }
         else if (appendParam.value().at(0) == 'T')
         {
             compositeData.asciiAppendCount = StringUtils::fromString<uint32_t>(appendParam.value().begin() + 1, appendParam.value().end());
-            if (!compositeData.asciiAppendCount.has_value()) { return std::nullopt; }
+            if (!compositeData.asciiAppendCount.has_value()) { return true; }
             extractor.discard(1);
         }
-        else { return std::nullopt; }
+        else { return true; }
     }
 
-    return std::make_optional(compositeData);
+    return false;
 }
 
-std::optional<Vector<AsciiMeasurementIndices, 9>> _getAsciiMeasurementIndices(AsciiMeasurementHeader asciiHeader)
-{
-    if (asciiHeader == AsciiMeasurementHeader::YPR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),  // Ypr
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::QTN)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 2),  // Quaternion
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::QMR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 2),   // Quaternion
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::MAG)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 8),  // Mag
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ACC)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-
-            AsciiMeasurementIndices(2, 9),  // Accel
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GYR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::MAR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YMR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YBA)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(4, 6),   // LinBodyAcc
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YIA)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(4, 7),   // LinAccelNed
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::IMU)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 1),  // UncompMag
-            AsciiMeasurementIndices(2, 2),  // UncompAccel
-            AsciiMeasurementIndices(2, 3),  // UncompGyro
-            AsciiMeasurementIndices(2, 4),  // Temperature
-            AsciiMeasurementIndices(2, 5),  // Pressure
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GPS)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(3, 1),   // GpsTow
-            AsciiMeasurementIndices(3, 2),   // GpsWeek
-            AsciiMeasurementIndices(3, 4),   // GnssFix
-            AsciiMeasurementIndices(3, 3),   // NumSats
-            AsciiMeasurementIndices(3, 5),   // GnssPosLla
-            AsciiMeasurementIndices(3, 7),   // GnssVelNed
-            AsciiMeasurementIndices(3, 9),   // GnssPosUncertainty
-            AsciiMeasurementIndices(3, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(3, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GPE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(3, 1),   // GpsTow
-            AsciiMeasurementIndices(3, 2),   // GpsWeek
-            AsciiMeasurementIndices(3, 4),   // GnssFix
-            AsciiMeasurementIndices(3, 3),   // NumSats
-            AsciiMeasurementIndices(3, 6),   // GnssPosEcef
-            AsciiMeasurementIndices(3, 8),   // GnssVelEcef
-            AsciiMeasurementIndices(3, 9),   // GnssPosUncertaintyEcef
-            AsciiMeasurementIndices(3, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(3, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::INS)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(1, 2),   // GpsTow
-            AsciiMeasurementIndices(1, 3),   // GpsWeek
-            AsciiMeasurementIndices(5, 0),   // InsStatus
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 1),   // PosLla
-            AsciiMeasurementIndices(5, 4),   // VelNed
-            AsciiMeasurementIndices(4, 13),  // AttU
-            AsciiMeasurementIndices(5, 9),   // PosU
-            AsciiMeasurementIndices(5, 10),  // VelU
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::INE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(1, 2),   // GpsTow
-            AsciiMeasurementIndices(1, 3),   // GpsWeek
-            AsciiMeasurementIndices(5, 0),   // InsStatus
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 2),   // PosEcef
-            AsciiMeasurementIndices(5, 5),   // VelEcef
-            AsciiMeasurementIndices(4, 13),  // AttU
-            AsciiMeasurementIndices(5, 9),   // PosU
-            AsciiMeasurementIndices(5, 10),  // VelU
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ISL)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 1),   // PosLla
-            AsciiMeasurementIndices(5, 4),   // VelNed
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ISE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 2),   // PosEcef
-            AsciiMeasurementIndices(5, 5),   // VelEcef
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::DTV)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 6),  // DeltaTheta
-            AsciiMeasurementIndices(2, 7),  // DeltaVel
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::G2S)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(6, 1),   // GpsTow
-            AsciiMeasurementIndices(6, 2),   // GpsWeek
-            AsciiMeasurementIndices(6, 4),   // GnssFix
-            AsciiMeasurementIndices(6, 3),   // NumSats
-            AsciiMeasurementIndices(6, 5),   // GnssPosLla
-            AsciiMeasurementIndices(6, 7),   // GnssVelNed
-            AsciiMeasurementIndices(6, 9),   // GnssPosUncertainty
-            AsciiMeasurementIndices(6, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(6, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::G2E)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(6, 1),   // GpsTow
-            AsciiMeasurementIndices(6, 2),   // GpsWeek
-            AsciiMeasurementIndices(6, 4),   // GnssFix
-            AsciiMeasurementIndices(6, 3),   // NumSats
-            AsciiMeasurementIndices(6, 6),   // GnssPosEcef
-            AsciiMeasurementIndices(6, 8),   // GnssVelEcef
-            AsciiMeasurementIndices(6, 9),   // GnssPosUncertaintyEcef
-            AsciiMeasurementIndices(6, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(6, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::HVE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 12),  // Heave
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::RTK)
-    {
-        // Deprecated or unused measurements
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{});
-    }
-    else { return std::nullopt; }
-};
-
 uint8_t _getNumAppendedFields(const uint8_t numFieldsPresent, const uint8_t numFieldsExpected) { return numFieldsPresent - numFieldsExpected; }
 
 }  // namespace AsciiPacketProtocol
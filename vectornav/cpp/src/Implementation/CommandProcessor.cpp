@@ -40,7 +40,7 @@ CommandProcessor::RegisterCommandReturn CommandProcessor::registerCommand(Comman
     pCommand->prepareToSend();
     AsciiMessage messageToSend;
     sprintf(messageToSend.begin(), "$VN%s", pCommand->getCommandString().c_str());
-    uint16_t crcValue = CalculateCRC((uint8_t*)messageToSend.c_str() + 1, messageToSend.length() - 1);
+    uint16_t crcValue = CalculateCRC(reinterpret_cast<const uint8_t*>(messageToSend.c_str()) + 1, messageToSend.length() - 1);
     sprintf(messageToSend.end(), "*%04X\r\n", crcValue);
     VN_DEBUG_1("TX: " + messageToSend);
     this->_cmdQueue.put(pCommand);
@@ -49,6 +49,18 @@ CommandProcessor::RegisterCommandReturn CommandProcessor::registerCommand(Comman
 
 bool CommandProcessor::matchResponse(const AsciiMessage& response, const AsciiPacketProtocol::Metadata& metadata) noexcept
 {  // Should be called on high-priority thread
+    Completions completions;
+    bool failed;
+    {
+        LockGuard lock(_mutex);
+        failed = _matchResponse(response, metadata, completions);
+    }
+    _invoke(completions);
+    return failed;
+}
+
+bool CommandProcessor::_matchResponse(const AsciiMessage& response, const AsciiPacketProtocol::Metadata& metadata, Completions& completions) noexcept
+{
     bool responseHasBeenMatched = false;
     VN_DEBUG_1("RX: " + response + "\t queue size: " + std::to_string(_cmdQueue.size()));
     if (StringUtils::startsWith(response, AsciiMessage("$VNERR,")))
@@ -63,6 +75,7 @@ bool CommandProcessor::matchResponse(const AsciiMessage& response, const AsciiPa
                 {
                     VN_ABORT();  // We just made sure it is a valid vnerr, should not be possible
                 }
+                _commandPopped(frontCommand.value(), true, completions);
             }
             else { _asyncErrorQueuePush(AsyncError(Error::ReceivedUnexpectedMessage, response)); }
         }
@@ -85,6 +98,7 @@ bool CommandProcessor::matchResponse(const AsciiMessage& response, const AsciiPa
             VN_ASSERT(frontCommandOutput.has_value());  // The while loop validates that the command queue is not empty
             auto frontCommand = frontCommandOutput.value();
             validResponse = frontCommand->matchResponse(response, metadata.timestamp);
+            _commandPopped(frontCommand, validResponse, completions);
             if (validResponse)
             {
                 responseHasBeenMatched = true;
@@ -101,6 +115,165 @@ bool CommandProcessor::matchResponse(const AsciiMessage& response, const AsciiPa
     return false;
 }
 
+Error CommandProcessor::sendCommand(Command* pCommand) noexcept
+{
+    LockGuard lock(_mutex);
+    return _registerAndSend(pCommand);
+}
+
+Error CommandProcessor::sendCommandAsync(Command* pCommand, CommandCompletion onComplete, const Microseconds timeout, const uint8_t retriesAllowed) noexcept
+{
+    LockGuard lock(_mutex);
+    if (_findTracked(pCommand).has_value()) { return Error::CommandResent; }
+    uint16_t id = 0;
+    while ((id < _trackedCapacity) && (_trackedCommands[id].command != nullptr)) { ++id; }
+    if (id == _trackedCapacity) { return Error::CommandQueueFull; }
+
+    const Error error = _registerAndSend(pCommand);
+    if (error != Error::None) { return error; }
+    // The response cannot be matched before we start tracking, as matching waits on the lock we hold.
+    _trackedCommands[id] = TrackedCommand{pCommand, std::move(onComplete), timeout, retriesAllowed};
+    _numTracked.fetch_add(1);
+    _timeouts.schedule(id, now() + timeout);
+    return Error::None;
+}
+
+bool CommandProcessor::cancelCommand(Command* pCommand) noexcept
+{
+    Completions completions;
+    {
+        LockGuard lock(_mutex);
+        const auto id = _findTracked(pCommand);
+        if (!id.has_value()) { return true; }
+        _cmdQueue.remove(pCommand);
+        pCommand->matchResponse("FAIL", time_point());  // Ensure awaiting flag is set false
+        _complete(*id, Error::ResponseTimeout, completions);
+    }
+    _invoke(completions);
+    return false;
+}
+
+void CommandProcessor::cancelAllCommands() noexcept
+{
+    Completions completions;
+    {
+        LockGuard lock(_mutex);
+        for (uint16_t id = 0; id < _trackedCapacity; ++id)
+        {
+            Command* pCommand = _trackedCommands[id].command;
+            if (pCommand == nullptr) { continue; }
+            _cmdQueue.remove(pCommand);
+            pCommand->matchResponse("FAIL", time_point());  // Ensure awaiting flag is set false
+            _complete(id, Error::ResponseTimeout, completions);
+        }
+    }
+    _invoke(completions);
+}
+
+void CommandProcessor::serviceTimeouts(const time_point currentTime) noexcept
+{
+    if (_numTracked.load() == 0) { return; }
+    Completions completions;
+    {
+        LockGuard lock(_mutex);
+        Vector<uint16_t, _trackedCapacity> expired;
+        _timeouts.advance(currentTime, [&expired](const uint16_t id) { expired.push_back(id); });
+        for (const uint16_t id : expired)
+        {
+            TrackedCommand& tracked = _trackedCommands[id];
+            _cmdQueue.remove(tracked.command);  // Still queued, unless a later command's response passed over it
+            tracked.command->matchResponse("FAIL", time_point());  // Ensure awaiting flag is set false so that it can be resent
+            if (tracked.retriesRemaining == 0)
+            {
+                VN_DEBUG_1("Command timed out.");
+                _complete(id, Error::ResponseTimeout, completions);
+                continue;
+            }
+            --tracked.retriesRemaining;
+            const Error error = _registerAndSend(tracked.command);
+            if (error != Error::None)
+            {
+                _complete(id, error, completions);
+                continue;
+            }
+            _timeouts.schedule(id, currentTime + tracked.timeout);
+        }
+    }
+    _invoke(completions);
+}
+
+std::optional<time_point> CommandProcessor::nextTimeout() const noexcept
+{
+    if (_numTracked.load() == 0) { return std::nullopt; }
+    LockGuard lock(_mutex);
+    return _timeouts.nextExpiry();
+}
+
+Error CommandProcessor::_registerAndSend(Command* pCommand) noexcept
+{
+    if (!_serialSend) { return Error::UnexpectedSerialError; }
+    const RegisterCommandReturn registered = registerCommand(pCommand);
+    switch (registered.error)
+    {
+        case (RegisterCommandReturn::Error::None):
+            break;
+        case (RegisterCommandReturn::Error::CommandQueueFull):
+            return Error::CommandQueueFull;
+        case (RegisterCommandReturn::Error::CommandResent):
+            return Error::CommandResent;
+        default:
+            VN_ABORT();
+    }
+    const Error error = _serialSend(registered.message);
+    if (error != Error::None)
+    {
+        // It never reached the unit, so don't leave it waiting for a response.
+        _cmdQueue.remove(pCommand);
+        pCommand->matchResponse("FAIL", time_point());
+    }
+    return error;
+}
+
+void CommandProcessor::_commandPopped(Command* pCommand, const bool matched, Completions& completions) noexcept
+{
+    if (_numTracked.load() == 0) { return; }
+    const auto id = _findTracked(pCommand);
+    if (!id.has_value()) { return; }
+    if (matched) { _complete(*id, pCommand->getError().value_or(Error::None), completions); }
+    else
+    {
+        // A later command's response passed over it, so it will never be answered. Resend or time it out as soon as timeouts are next serviced.
+        _timeouts.schedule(*id, now());
+    }
+}
+
+std::optional<uint16_t> CommandProcessor::_findTracked(const Command* pCommand) const noexcept
+{
+    for (uint16_t id = 0; id < _trackedCapacity; ++id)
+    {
+        if (_trackedCommands[id].command == pCommand) { return id; }
+    }
+    return std::nullopt;
+}
+
+void CommandProcessor::_complete(const uint16_t id, const Error error, Completions& completions) noexcept
+{
+    TrackedCommand& tracked = _trackedCommands[id];
+    _timeouts.cancel(id);
+    completions.push_back(Completion{std::move(tracked.onComplete), tracked.command, error});
+    tracked = TrackedCommand{};
+    _numTracked.fetch_sub(1);
+}
+
+void CommandProcessor::_invoke(Completions& completions) noexcept
+{
+    // Called without the lock held, so completions may send further commands.
+    for (auto& completion : completions)
+    {
+        if (completion.onComplete) { completion.onComplete(completion.command, completion.error); }
+    }
+}
+
 int CommandProcessor::getQueueSize() const noexcept { return this->_cmdQueue.size(); }
 
 void CommandProcessor::popCommandFromQueueBack() noexcept { _cmdQueue.popBack(); }
@@ -28,8 +28,25 @@ namespace VN
 {
 PacketDispatcher::FindPacketRetVal FaPacketDispatcher::findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
 {
-    FaPacketProtocol::FindPacketReturn findPacketRetVal = FaPacketProtocol::findPacket(byteBuffer, syncByteIndex);
-    if (findPacketRetVal.validity == FaPacketProtocol::Validity::Valid) { _latestPacketMetadata = findPacketRetVal.metadata; }
+    FaPacketProtocol::FindPacketReturn findPacketRetVal = FaPacketProtocol::findPacket(byteBuffer, syncByteIndex, &_headerLayoutCache);
+    if (findPacketRetVal.validity == FaPacketProtocol::Validity::Valid)
+    {
+        _latestPacketMetadata = findPacketRetVal.metadata;
+        _latestPacketMetadata.timestamp = _packetReceivedTime(byteBuffer, syncByteIndex, findPacketRetVal.metadata.length);
+        _latestPacketLayout = findPacketRetVal.layout;
+    }
+    return {findPacketRetVal.validity, findPacketRetVal.metadata.length};
+}
+
+PacketDispatcher::FindPacketRetVal FaPacketDispatcher::findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const time_point receivedAt) noexcept
+{
+    FaPacketProtocol::FindPacketReturn findPacketRetVal = FaPacketProtocol::findPacket(byteBuffer, syncByteIndex, &_headerLayoutCache);
+    if (findPacketRetVal.validity == FaPacketProtocol::Validity::Valid)
+    {
+        _latestPacketMetadata = findPacketRetVal.metadata;
+        _latestPacketMetadata.timestamp = receivedAt;
+        _latestPacketLayout = findPacketRetVal.layout;
+    }
     return {findPacketRetVal.validity, findPacketRetVal.metadata.length};
 }
 
@@ -37,10 +54,12 @@ void FaPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const size
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
     bool packetConsumed = false;
-    _invokeSubscribers(byteBuffer, syncByteIndex, _latestPacketMetadata);
-    if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity > 0)
+    const SubscriberRoute& route = _findSubscriberRoute(_latestPacketMetadata.header);
+    _invokeSubscribers(byteBuffer, syncByteIndex, _latestPacketMetadata, route);
+    if (Config::PacketDispatchers::compositeDataQueueCapacity > 0 || _hasMeasurementCallbacks.load())
     {
-        packetConsumed |= _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata);
+        _applyRequestedMeasurements();
+        packetConsumed |= _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata, route.measurementHeader);
     }
 }
 
@@ -52,91 +71,216 @@ bool FaPacketDispatcher::addSubscriber(PacketQueue_Interface* subscriber, Enable
         for (auto& group : headerToUse) { group = std::numeric_limits<uint32_t>::max(); }
         filterType = SubscriberFilterType::AnyMatch;
     }
-    return _subscribers.push_back(Subscriber{subscriber, headerToUse, filterType});
+    const bool failed = _subscribers.push_back(Subscriber{subscriber, headerToUse, filterType});
+    _subscribersVersion.fetch_add(1);
+    return failed;
 }
 
 void FaPacketDispatcher::removeSubscriber(PacketQueue_Interface* subscriberToRemove) noexcept
 {
-    for (auto itr = _subscribers.rbegin(); itr != _subscribers.rend(); ++itr)
+    for (size_t i = _subscribers.size(); i > 0; --i)
     {
-        auto& subscriber = *itr;
-        if (subscriberToRemove == subscriber.queueToPush) { _subscribers.erase(itr.base()); }
+        auto itr = _subscribers.begin() + (i - 1);
+        if (subscriberToRemove == itr->queueToPush) { _subscribers.erase(itr); }
     }
+    _subscribersVersion.fetch_add(1);
 }
 
 void FaPacketDispatcher::removeSubscriber(PacketQueue_Interface* subscriberToRemove, const EnabledMeasurements& headerToUse) noexcept
 {
-    for (auto itr = _subscribers.rbegin(); itr != _subscribers.rend(); ++itr)
+    for (size_t i = _subscribers.size(); i > 0; --i)
+    {
+        auto itr = _subscribers.begin() + (i - 1);
+        if ((subscriberToRemove == itr->queueToPush) && (headerToUse == itr->headerFilter)) { _subscribers.erase(itr); }
+    }
+    _subscribersVersion.fetch_add(1);
+}
+
+bool FaPacketDispatcher::addMeasurementCallback(MeasurementCallback callback, EnabledMeasurements headerToUse, SubscriberFilterType filterType) noexcept
+{
+    if (!callback) { return true; }
+    if (headerToUse == EnabledMeasurements{0})
     {
-        auto& subscriber = *itr;
-        if (subscriberToRemove == subscriber.queueToPush)
+        // If they pass no header filter, we should match on any message
+        for (auto& group : headerToUse) { group = std::numeric_limits<uint32_t>::max(); }
+        filterType = SubscriberFilterType::AnyMatch;
+    }
+    LockGuard lock(_measurementCallbacksMutex);
+    const bool failed = _measurementCallbacks.push_back(MeasurementCallbackEntry{std::move(callback), headerToUse, filterType});
+    _hasMeasurementCallbacks.store(!_measurementCallbacks.empty());
+    return failed;
+}
+
+void FaPacketDispatcher::removeMeasurementCallbacks() noexcept
+{
+    LockGuard lock(_measurementCallbacksMutex);
+    for (auto& entry : _measurementCallbacks) { entry.callback = nullptr; }  // Release anything the callables captured
+    _measurementCallbacks.clear();
+    _hasMeasurementCallbacks.store(false);
+}
+
+void FaPacketDispatcher::removeMeasurementCallbacks(const EnabledMeasurements& headerToUse) noexcept
+{
+    LockGuard lock(_measurementCallbacksMutex);
+    for (size_t i = _measurementCallbacks.size(); i > 0; --i)
+    {
+        auto itr = _measurementCallbacks.begin() + (i - 1);
+        if (itr->headerFilter == headerToUse)
         {
-            if (headerToUse == subscriber.headerFilter) { _subscribers.erase(itr.base()); }
+            itr->callback = nullptr;
+            _measurementCallbacks.erase(itr);
         }
     }
+    _hasMeasurementCallbacks.store(!_measurementCallbacks.empty());
 }
 
-bool FaPacketDispatcher::_tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex,
-                                                      const FaPacketProtocol::Metadata& packetDetails) noexcept
+void FaPacketDispatcher::setMeasurementsToParse(EnabledMeasurements measurementsToParse) noexcept
 {
-    VN_PROFILER_TIME_CURRENT_SCOPE();
-    if (!anyDataIsEnabled(packetDetails.header.toMeasurementHeader(), _enabledMeasurements)) { return false; }
-    auto compositeData = FaPacketProtocol::parsePacket(byteBuffer, syncByteIndex, packetDetails, _enabledMeasurements);
-    if (!compositeData.has_value()) { return false; }
+    // If they pass no measurements, we should parse everything available
+    if (measurementsToParse == EnabledMeasurements{0}) { measurementsToParse = _availableMeasurements; }
+    LockGuard lock(_requestedMeasurementsMutex);
+    _requestedMeasurements = intersectionOf(measurementsToParse, _availableMeasurements);
+    _requestedMeasurementsVersion.fetch_add(1);
+}
+
+void FaPacketDispatcher::_applyRequestedMeasurements() noexcept
+{
+    if (_requestedMeasurementsVersion.load() == _enabledMeasurementsVersion) { return; }
+    LockGuard lock(_requestedMeasurementsMutex);
+    _enabledMeasurements = _requestedMeasurements;
+    _enabledMeasurementsVersion = _requestedMeasurementsVersion.load();
+}
 
-    // Copy to the output queue
-    auto pCompositeData = _compositeDataQueue->put();
-    if (!pCompositeData) { return false; }
-    *pCompositeData = compositeData.value();  // Todo 477: INvestigate passing pointer into the parser, rather than returning and copying it. Will that
-                                              // be more efficient than calling "reset" and assigning values?
-    return true;
+bool FaPacketDispatcher::_parseMeasurement(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                                           CompositeData& compositeData) const noexcept
+{
+    return (_latestPacketLayout != nullptr)
+               ? FaPacketProtocol::parsePacket(byteBuffer, syncByteIndex, packetDetails, *_latestPacketLayout, _enabledMeasurements, compositeData)
+               : FaPacketProtocol::parsePacket(byteBuffer, syncByteIndex, packetDetails, _enabledMeasurements, compositeData);
 }
 
-void FaPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept
+bool FaPacketDispatcher::_tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex,
+                                                      const FaPacketProtocol::Metadata& packetDetails, const EnabledMeasurements& packetHeader) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
-    for (auto& subscriber : _subscribers)
+    if (!anyDataIsEnabled(packetHeader, _enabledMeasurements)) { return false; }
+    if (Config::PacketDispatchers::compositeDataQueueCapacity > 0)
     {
-        const auto filterHeader = subscriber.headerFilter;
-        const auto packetHeader = packetDetails.header.toMeasurementHeader();
-        bool pushToSub;
-        switch (subscriber.filterType)
+        // Parse straight into the output queue's slot (or, if it is compact, the parse buffer), abandoning it if the packet turns out to be unparsable.
+        auto pMeasurement = _compositeDataQueue->put();
+        if (pMeasurement)
         {
-            case (SubscriberFilterType::AnyMatch):
-            {
-                pushToSub = anyDataIsEnabled(filterHeader, packetHeader);
-                break;
-            }
-            case (SubscriberFilterType::ExactMatch):
+            CompositeData& compositeData = measurementToParseInto(*pMeasurement, _measurementParseBuffer);
+            if (_parseMeasurement(byteBuffer, syncByteIndex, packetDetails, compositeData))
             {
-                pushToSub = filterHeader == packetHeader;
-                break;
+                pMeasurement.abandon();
+                return false;
             }
-            case (SubscriberFilterType::NotExactMatch):
-            {
-                pushToSub = filterHeader != packetHeader;
-                break;
-            }
-            default:
-                VN_ABORT();
+            // Callbacks run while we still own the slot, so they see the measurement before any queue consumer can, without a copy.
+            if (_hasMeasurementCallbacks.load()) { _invokeMeasurementCallbacks(packetHeader, compositeData); }
+            storeParsedMeasurement(*pMeasurement, compositeData);
+            return true;
         }
-        if (pushToSub) { [[maybe_unused]] const bool failed = _tryPushToSubscriber(byteBuffer, syncByteIndex, packetDetails, subscriber); }
+    }
+    // There is nowhere to publish the measurement, but the callbacks still need it.
+    if (!_hasMeasurementCallbacks.load()) { return false; }
+    CompositeData compositeData;
+    if (_parseMeasurement(byteBuffer, syncByteIndex, packetDetails, compositeData)) { return false; }
+    _invokeMeasurementCallbacks(packetHeader, compositeData);
+    return false;
+}
+
+void FaPacketDispatcher::_invokeMeasurementCallbacks(const EnabledMeasurements& packetHeader, const CompositeData& compositeData) noexcept
+{
+    VN_PROFILER_TIME_CURRENT_SCOPE();
+    LockGuard lock(_measurementCallbacksMutex);
+    for (const auto& entry : _measurementCallbacks)
+    {
+        if (_matchesFilter(entry.headerFilter, entry.filterType, packetHeader)) { entry.callback(compositeData); }
+    }
+}
+
+bool FaPacketDispatcher::_matchesFilter(const EnabledMeasurements& filterHeader, const SubscriberFilterType filterType,
+                                        const EnabledMeasurements& packetHeader) noexcept
+{
+    switch (filterType)
+    {
+        case (SubscriberFilterType::AnyMatch):
+            return anyDataIsEnabled(filterHeader, packetHeader);
+        case (SubscriberFilterType::ExactMatch):
+            return filterHeader == packetHeader;
+        case (SubscriberFilterType::NotExactMatch):
+            return filterHeader != packetHeader;
+        default:
+            VN_ABORT();
+    }
+}
+
+uint32_t FaPacketDispatcher::_hashHeader(const BinaryHeader& header) noexcept
+{
+    // FNV-1a, only to rule out most routes without comparing the whole header
+    uint32_t hash = 2166136261u;
+    const auto mix = [&hash](const uint32_t value) { hash = (hash ^ value) * 16777619u; };
+    for (const uint8_t group : header.outputGroups) { mix(group); }
+    for (const uint16_t type : header.outputTypes) { mix(type); }
+    return hash;
+}
+
+const FaPacketDispatcher::SubscriberRoute& FaPacketDispatcher::_findSubscriberRoute(const BinaryHeader& header) noexcept
+{
+    const uint32_t headerHash = _hashHeader(header);
+    const uint32_t subscribersVersion = _subscribersVersion.load();
+    for (auto& route : _subscriberRoutes)
+    {
+        if ((route.subscribersVersion == 0) || (route.headerHash != headerHash) || !(route.header == header)) { continue; }
+        if (route.subscribersVersion != subscribersVersion) { _routeSubscribers(route, subscribersVersion); }
+        return route;
+    }
+
+    SubscriberRoute& route = _subscriberRoutes[_nextSubscriberRouteToReplace];
+    _nextSubscriberRouteToReplace = (_nextSubscriberRouteToReplace + 1) % _subscriberRoutes.size();
+    route.header = header;
+    route.headerHash = headerHash;
+    route.measurementHeader = header.toMeasurementHeader();
+    _routeSubscribers(route, subscribersVersion);
+    return route;
+}
+
+void FaPacketDispatcher::_routeSubscribers(SubscriberRoute& route, const uint32_t subscribersVersion) const noexcept
+{
+    route.queues.clear();
+    for (const auto& subscriber : _subscribers)
+    {
+        if (_matchesFilter(subscriber.headerFilter, subscriber.filterType, route.measurementHeader)) { route.queues.push_back(subscriber.queueToPush); }
+    }
+    route.subscribersVersion = subscribersVersion;
+}
+
+void FaPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                                            const SubscriberRoute& route) noexcept
+{
+    VN_PROFILER_TIME_CURRENT_SCOPE();
+    if (route.queues.empty()) { return; }
+    // Copied out of the byte buffer once, however many subscribers receive it.
+    const SharedPacketBuffer sharedBuffer = _packetArena.store(byteBuffer, syncByteIndex, packetDetails.length);
+    for (PacketQueue_Interface* queueToPush : route.queues)
+    {
+        [[maybe_unused]] const bool failed = _tryPushToSubscriber(byteBuffer, syncByteIndex, packetDetails, queueToPush, sharedBuffer);
     }
 }
 
 bool FaPacketDispatcher::_tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
-                                              Subscriber& subscriber) noexcept
+                                              PacketQueue_Interface* queueToPush, const SharedPacketBuffer& sharedBuffer) noexcept
 {
-    auto putSlot = subscriber.queueToPush->put();
+    auto putSlot = putSubscriberPacket(queueToPush, byteBuffer, syncByteIndex, packetDetails.length, sharedBuffer);
     if (putSlot)
     {
         putSlot->details.syncByte = PacketDetails::SyncByte::FA;
         putSlot->details.faMetadata = packetDetails;
-        byteBuffer.peek_unchecked(putSlot->buffer, packetDetails.length, syncByteIndex);
     }
     else
     {
-        // Putting failed
+        // Putting failed, or the arena was full and the slot had no buffer of its own
         return true;
     }
     return false;
@@ -42,20 +42,23 @@ namespace
 {
 bool _isValidBinaryCrc(const ByteBuffer& buffer, const size_t syncByteIndex, const size_t packetLength) noexcept
 {
-    uint16_t calculatedCrc = 0;
     // Crc validation does not include sync byte
-    for (size_t fromHeadIndex = syncByteIndex + 1; fromHeadIndex < (syncByteIndex + packetLength); ++fromHeadIndex)
-    {
-        _calculateCRC(&calculatedCrc, buffer.peek_unchecked(fromHeadIndex));
-    }
-    return calculatedCrc == 0;
+    return CalculateCRC(buffer, syncByteIndex + 1, packetLength - 1) == 0;
+}
+
+bool _isGnssGroup(const size_t binaryGroupOffset) noexcept { return binaryGroupOffset == 3 || binaryGroupOffset == 6 || binaryGroupOffset == 12; }
+
+bool _isDynamicLengthType(const size_t binaryGroupOffset, const size_t binaryTypeOffset) noexcept
+{
+    // Sat Info and Raw Meas
+    return _isGnssGroup(binaryGroupOffset) && (binaryTypeOffset == 14 || binaryTypeOffset == 16);
 }
 
 PacketDispatcher::FindPacketRetVal::Validity _calculateBinaryMeasurementTypeSize(const ByteBuffer& buffer, const size_t typeDataStartIndex,
                                                                                  const size_t binaryGroupOffset, const size_t binaryTypeOffset,
                                                                                  size_t& binaryTypeSize) noexcept
 {
-    if (binaryGroupOffset == 3 || binaryGroupOffset == 6 || binaryGroupOffset == 12)
+    if (_isGnssGroup(binaryGroupOffset))
     {  // Is a GNSS group
         if (binaryTypeOffset == 14)
         {  // Is Sat Info
@@ -196,11 +199,58 @@ PacketDispatcher::FindPacketRetVal::Validity _populateHeader(const ByteBuffer& b
 
 }  // namespace
 
-FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+const HeaderLayout* HeaderLayoutCache::find(const ByteBuffer& byteBuffer, const size_t syncByteIndex) const noexcept
+{
+    const size_t numPacketBytesInBuffer = byteBuffer.size() - syncByteIndex;
+    for (size_t entryIndex = 0; entryIndex < _numEntries; ++entryIndex)
+    {
+        const HeaderLayout& entry = _entries[entryIndex];
+        if (numPacketBytesInBuffer < 1 + entry.rawHeader.size()) { continue; }
+
+        bool matches = true;
+        for (size_t i = 0; matches && (i < entry.rawHeader.size()); ++i) { matches = entry.rawHeader[i] == byteBuffer.peek_unchecked(syncByteIndex + 1 + i); }
+        if (matches) { return &entry; }
+    }
+    return nullptr;
+}
+
+const HeaderLayout* HeaderLayoutCache::insert(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const BinaryHeader& header) noexcept
+{
+    HeaderLayout layout;
+    layout.header = header;
+    for (size_t i = 0; i < header.size(); ++i)
+    {
+        if (layout.rawHeader.push_back(byteBuffer.peek_unchecked(syncByteIndex + 1 + i))) { return nullptr; }
+    }
+
+    size_t fieldOffset = 1 + header.size();
+    BinaryHeaderIterator iter(header);
+    while (iter.next())
+    {
+        if (_isDynamicLengthType(iter.group(), iter.field()))
+        {  // Only the header is worth remembering; the field offsets change packet to packet.
+            layout.hasDynamicLengthFields = true;
+            layout.fields.clear();
+            break;
+        }
+        const auto fieldSize = getStaticBinaryTypeSize(iter.group(), iter.field());
+        if (!fieldSize.has_value()) { return nullptr; }
+        if (layout.fields.push_back({iter.group(), iter.field(), static_cast<uint16_t>(fieldOffset)})) { return nullptr; }
+        fieldOffset += fieldSize.value();
+    }
+    if (!layout.hasDynamicLengthFields) { layout.payloadLength = fieldOffset - 1 - header.size(); }
+
+    const size_t entryIndex = _nextEntryToReplace;
+    _entries[entryIndex] = layout;
+    _nextEntryToReplace = (_nextEntryToReplace + 1) % _entries.size();
+    _numEntries = std::max(_numEntries, entryIndex + 1);
+    return &_entries[entryIndex];
+}
+
+FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex, HeaderLayoutCache* layoutCache) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
     Metadata metadata;
-    metadata.timestamp = now();
 
     uint8_t tmpByte = byteBuffer.peek_unchecked(syncByteIndex);
 
@@ -212,24 +262,40 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
         return {Validity::Incomplete, Metadata{BinaryHeader{}, 7, time_point{}}};
     }
 
+    const HeaderLayout* layout = (layoutCache != nullptr) ? layoutCache->find(byteBuffer, syncByteIndex) : nullptr;
+    if ((layout != nullptr) && !layout->hasDynamicLengthFields)
+    {  // Known header of fixed length, so we can go straight to the crc.
+        const size_t requiredPacketLength = 1 + layout->rawHeader.size() + layout->payloadLength + 2;
+        if (numPacketBytesInBuffer < requiredPacketLength) { return {Validity::Incomplete, Metadata{BinaryHeader{}, requiredPacketLength, time_point{}}}; }
+
+        metadata.header = layout->header;
+        metadata.length = requiredPacketLength;
+        const bool isValidCrc = _isValidBinaryCrc(byteBuffer, syncByteIndex, requiredPacketLength);
+        return isValidCrc ? FindPacketReturn{Validity::Valid, metadata, layout} : FindPacketReturn{Validity::Invalid, metadata};
+    }
+
     BinaryHeader header{};
-    PacketDispatcher::FindPacketRetVal::Validity headerValidity = _populateHeader(byteBuffer, syncByteIndex, header);
-    switch (headerValidity)
+    if (layout != nullptr) { header = layout->header; }
+    else
     {
-        case (Validity::Invalid):
-            // Fall through
-        case (Validity::Incomplete):
-        {
-            return {headerValidity, Metadata{BinaryHeader{}, 7, time_point{}}};
-        }
-        case (Validity::Valid):
-        {
-            // Everything completed fine. Proceed normally.
-            break;
-        }
-        default:
+        PacketDispatcher::FindPacketRetVal::Validity headerValidity = _populateHeader(byteBuffer, syncByteIndex, header);
+        switch (headerValidity)
         {
-            VN_ABORT();
+            case (Validity::Invalid):
+                // Fall through
+            case (Validity::Incomplete):
+            {
+                return {headerValidity, Metadata{BinaryHeader{}, 7, time_point{}}};
+            }
+            case (Validity::Valid):
+            {
+                // Everything completed fine. Proceed normally.
+                break;
+            }
+            default:
+            {
+                VN_ABORT();
+            }
         }
     }
     uint8_t headerSize = header.outputGroups.size() + header.outputTypes.size() * 2;
@@ -261,14 +327,35 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
     metadata.length = requiredPacketLength;
 
     const bool isValidCrc = _isValidBinaryCrc(byteBuffer, syncByteIndex, requiredPacketLength);
-    return isValidCrc ? FindPacketReturn{Validity::Valid, metadata} : FindPacketReturn{Validity::Invalid, metadata};
+    if (!isValidCrc) { return FindPacketReturn{Validity::Invalid, metadata}; }
+
+    // Only remember headers of packets which passed the crc, so noise cannot evict real layouts.
+    if ((layoutCache != nullptr) && (layout == nullptr)) { layout = layoutCache->insert(byteBuffer, syncByteIndex, header); }
+    return FindPacketReturn{Validity::Valid, metadata, layout};
 }
 
 std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
-                                         [[maybe_unused]] const EnabledMeasurements& measurementsToParse) noexcept
+                                         const EnabledMeasurements& measurementsToParse) noexcept
+{
+    CompositeData compositeData;
+    if (parsePacket(buffer, syncByteIndex, metadata, measurementsToParse, compositeData)) { return std::nullopt; }
+    return std::make_optional(compositeData);
+}
+
+std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, const HeaderLayout& layout,
+                                         const EnabledMeasurements& measurementsToParse) noexcept
+{
+    CompositeData compositeData;
+    if (parsePacket(buffer, syncByteIndex, metadata, layout, measurementsToParse, compositeData)) { return std::nullopt; }
+    return std::make_optional(compositeData);
+}
+
+bool parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, const EnabledMeasurements& measurementsToParse,
+                 CompositeData& compositeData) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
-    CompositeData compositeData(metadata.header);
+    compositeData.reset(metadata.header, measurementsToParse);
+    compositeData.timestamp = metadata.timestamp;
 
     FaPacketExtractor extractor(buffer, metadata, syncByteIndex);
     extractor.discard(metadata.header.size() + 1);
@@ -279,13 +366,37 @@ std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t
     {
         size_t fieldSize = 0;
         auto validity = _calculateBinaryMeasurementTypeSize(buffer, syncByteIndex + extractor.index(), iter.group(), iter.field(), fieldSize);
-        if (validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) { return std::nullopt; }
-        if (compositeData.copyFromBuffer(extractor, iter.group(), iter.field())) { extractor.discard(fieldSize); }
+        if (validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) { return true; }
+        // Unwanted fields are stepped over without their bytes being read.
+        if (!holdsAnyMeasurement(measurementsToParse, iter.group(), iter.field()) || compositeData.copyFromBuffer(extractor, iter.group(), iter.field()))
+        {
+            extractor.discard(fieldSize);
+        }
         else { consumed = true; }
     }
 
-    if (extractor.index() != (metadata.length - 2)) { return std::nullopt; }
-    return (consumed) ? std::make_optional(compositeData) : std::nullopt;
+    if (extractor.index() != (metadata.length - 2)) { return true; }
+    return !consumed;
+}
+
+bool parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, const HeaderLayout& layout,
+                 const EnabledMeasurements& measurementsToParse, CompositeData& compositeData) noexcept
+{
+    if (layout.hasDynamicLengthFields) { return parsePacket(buffer, syncByteIndex, metadata, measurementsToParse, compositeData); }
+
+    VN_PROFILER_TIME_CURRENT_SCOPE();
+    compositeData.reset(metadata.header, measurementsToParse);
+    compositeData.timestamp = metadata.timestamp;
+
+    FaPacketExtractor extractor(buffer, metadata, syncByteIndex);
+    bool consumed = false;
+    for (const auto& field : layout.fields)
+    {
+        if (!holdsAnyMeasurement(measurementsToParse, field.group, field.field)) { continue; }  // Each wanted field is seeked to directly
+        extractor.seek(field.offset);
+        if (!compositeData.copyFromBuffer(extractor, field.group, field.field)) { consumed = true; }
+    }
+    return !consumed;
 }
 
 }  // namespace FaPacketProtocol
@@ -52,7 +52,13 @@ void FbPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const size
         return;
     }
 
-    if (_latestPacketMetadata.header.currentPacketCount == 1) { _resetFbBuffer(); }
+    // The reassembled packet is stamped by its first fragment or, if timestampAtLastByte, its last.
+    const time_point fragmentReceivedTime = _packetReceivedTime(byteBuffer, syncByteIndex, _latestPacketMetadata.length);
+    if (_latestPacketMetadata.header.currentPacketCount == 1)
+    {
+        _resetFbBuffer();
+        _firstFragmentReceivedTime = fragmentReceivedTime;
+    }
 
     const bool errorOccured = _moveBytesFromMainBufferToFbBuffer(_latestPacketMetadata.header, byteBuffer, _latestPacketMetadata.header.payloadLength,
                                                                  syncByteIndex + 1 + 5);  // Add after FB header
@@ -63,7 +69,8 @@ void FbPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const size
     {
         _addFaPacketCrc();
 
-        const auto retVal = _faPacketDispatcher->findPacket(_fbByteBuffer, 0);
+        const time_point receivedAt = Config::PacketFinders::timestampAtLastByte ? fragmentReceivedTime : _firstFragmentReceivedTime;
+        const auto retVal = _faPacketDispatcher->findPacket(_fbByteBuffer, 0, receivedAt);
 
         if (retVal.validity == PacketDispatcher::FindPacketRetVal::Validity::Valid) { _faPacketDispatcher->dispatchPacket(_fbByteBuffer, 0); }
         _fbByteBuffer.reset();
@@ -92,10 +99,8 @@ void FbPacketDispatcher::_resetFbBuffer() noexcept
 
 void FbPacketDispatcher::_addFaPacketCrc() noexcept
 {
-    uint16_t crc = 0;
-
     // Calculate a CRC over everything but the sync byte
-    for (size_t i = 1; i < _fbByteBuffer.size(); ++i) { _calculateCRC(&crc, _fbByteBuffer.peek(i).value()); }
+    const uint16_t crc = CalculateCRC(_fbByteBuffer, 1, _fbByteBuffer.size() - 1);
 
     // Crc is put in big endian
     uint8_t data = 0;
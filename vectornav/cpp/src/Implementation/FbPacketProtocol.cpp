@@ -30,13 +30,8 @@ namespace FbPacketProtocol
 {
 bool _isValidBinaryCrc(const ByteBuffer& buffer, const size_t syncByteIndex, const size_t packetLength) noexcept
 {
-    uint16_t calculatedCrc = 0;
     // Crc validation does not include sync byte
-    for (size_t fromHeadIndex = syncByteIndex + 1; fromHeadIndex < (syncByteIndex + packetLength); ++fromHeadIndex)
-    {
-        _calculateCRC(&calculatedCrc, buffer.peek_unchecked(fromHeadIndex));
-    }
-    return calculatedCrc == 0;
+    return CalculateCRC(buffer, syncByteIndex + 1, packetLength - 1) == 0;
 }
 
 FbPacketProtocol::FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
@@ -0,0 +1,133 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Implementation/PacketArena.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <new>
+
+namespace VN
+{
+
+struct SharedPacketBuffer::Storage
+{
+    explicit Storage(const size_t capacity) : words(new uint64_t[capacity / sizeof(uint64_t)]) {}
+
+    std::atomic<uint32_t> liveBlocks{1};  // Blocks with handles, plus one for the arena itself. Whichever is released last frees the storage.
+    std::unique_ptr<uint64_t[]> words;    // Keeps every block aligned for its header
+};
+
+void SharedPacketBuffer::reset() noexcept
+{
+    if (_block == nullptr) { return; }
+    Storage* storage = _block->storage;  // Read first, as the arena may reuse the block as soon as it is free
+    if (_block->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        if (storage->liveBlocks.fetch_sub(1, std::memory_order_acq_rel) == 1) { delete storage; }
+    }
+    _block = nullptr;
+}
+
+PacketArena::PacketArena(const size_t capacity)
+{
+    _capacity = std::min<size_t>(capacity, std::numeric_limits<uint32_t>::max()) & ~(alignof(BlockHeader) - 1);
+    if (_capacity < sizeof(BlockHeader)) { _capacity = 0; }
+}
+
+PacketArena::~PacketArena()
+{
+    if ((_storage != nullptr) && (_storage->liveBlocks.fetch_sub(1, std::memory_order_acq_rel) == 1)) { delete _storage; }
+}
+
+SharedPacketBuffer PacketArena::store(const ByteBuffer& byteBuffer, const size_t startIndex, const size_t length) noexcept
+{
+    static_assert(alignof(BlockHeader) <= alignof(uint64_t));
+    constexpr size_t blockAlignment = alignof(BlockHeader);
+    const size_t neededLength = (sizeof(BlockHeader) + length + blockAlignment - 1) & ~(blockAlignment - 1);
+    if (neededLength > _capacity) { return SharedPacketBuffer(); }
+    if (_storage == nullptr)
+    {
+        // Held off until now, so that a dispatcher nobody subscribes to costs nothing
+        _storage = new Storage(_capacity);
+        _setFreeBlock(0, _capacity);
+    }
+
+    // Walk the blocks from where the last packet went, merging free neighbours into a run, until the run is long enough. Blocks still held are stepped
+    // over. Runs cannot wrap past the end, and the walk goes far enough around to reconsider a run which straddles where it started.
+    size_t blockIndex = _nextBlockIndex;
+    size_t runIndex = blockIndex;
+    size_t runLength = 0;
+    for (size_t walked = 0; walked < _capacity + neededLength;)
+    {
+        if (blockIndex == _capacity)
+        {
+            blockIndex = 0;
+            runIndex = 0;
+            runLength = 0;
+        }
+        const BlockHeader* block = _blockAt(blockIndex);
+        const size_t blockLength = block->blockLength;
+        const bool isHeld = block->refCount.load(std::memory_order_acquire) != 0;
+        blockIndex += blockLength;
+        walked += blockLength;
+        if (isHeld)
+        {
+            runIndex = blockIndex;
+            runLength = 0;
+            continue;
+        }
+
+        runLength += blockLength;
+        if (runLength < neededLength) { continue; }
+
+        size_t newBlockLength = neededLength;
+        if (runLength - neededLength < sizeof(BlockHeader)) { newBlockLength = runLength; }  // Too short to be a block of its own
+        else { _setFreeBlock(runIndex + neededLength, runLength - neededLength); }
+
+        BlockHeader* newBlock = _blockAt(runIndex);
+        newBlock->blockLength = static_cast<uint32_t>(newBlockLength);
+        newBlock->length = static_cast<uint32_t>(length);
+        byteBuffer.peek_unchecked(reinterpret_cast<uint8_t*>(newBlock + 1), length, startIndex);
+        _storage->liveBlocks.fetch_add(1, std::memory_order_relaxed);
+        newBlock->refCount.store(1, std::memory_order_relaxed);  // Published to other threads along with the packet holding the handle
+
+        _nextBlockIndex = runIndex + newBlockLength;
+        if (_nextBlockIndex == _capacity) { _nextBlockIndex = 0; }
+        return SharedPacketBuffer(newBlock);
+    }
+    return SharedPacketBuffer();
+}
+
+SharedPacketBuffer::BlockHeader* PacketArena::_blockAt(const size_t index) const noexcept
+{
+    return reinterpret_cast<BlockHeader*>(reinterpret_cast<uint8_t*>(_storage->words.get()) + index);
+}
+
+void PacketArena::_setFreeBlock(const size_t index, const size_t blockLength) noexcept
+{
+    new (_blockAt(index)) BlockHeader{{0}, static_cast<uint32_t>(blockLength), 0, _storage};
+}
+
+}  // namespace VN
@@ -24,85 +24,121 @@
 
 #include "Implementation/PacketSynchronizer.hpp"
 #include "Debug.hpp"
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VN_SYNC_SCAN_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define VN_SYNC_SCAN_NEON 1
+#include <arm_neon.h>
+#endif
 
 namespace VN
 {
 
 bool PacketSynchronizer::addDispatcher(PacketDispatcher* packetParser) noexcept
 {
-    return _dispatchers.push_back({packetParser, packetParser->getSyncBytes(), PacketDispatcher::FindPacketRetVal()});
+    if (_dispatchers.push_back({packetParser, packetParser->getSyncBytes(), PacketDispatcher::FindPacketRetVal()})) { return true; }
+
+    // TODO 133: Modify to handle multi-size sync bytes
+    const uint8_t syncByte = packetParser->getSyncBytes().front();
+    _isSyncByte[syncByte] = true;
+    if (_dispatchers.size() == 1) { _syncByteSet.fill(syncByte); }
+    else { _syncByteSet[_dispatchers.size() - 1] = syncByte; }
+    return false;
+}
+
+bool PacketSynchronizer::dispatchNextPacket() noexcept { return _dispatchPackets(1) == 0; }
+
+size_t PacketSynchronizer::dispatchAllPackets() noexcept { return _dispatchPackets(std::numeric_limits<size_t>::max()); }
+
+void PacketSynchronizer::reset() noexcept
+{
+    _prevByteBufferSize = 0;
+    _prevBytesRequested = 0;
+    _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Invalid;
 }
 
-bool PacketSynchronizer::dispatchNextPacket() noexcept
+size_t PacketSynchronizer::_dispatchPackets(const size_t maxNumPackets) noexcept
 {
     size_t byteBufferSize = _primaryByteBuffer.size();
     if (byteBufferSize == 0 || ((_prevValidity == PacketDispatcher::FindPacketRetVal::Validity::Incomplete) && (byteBufferSize < _prevBytesRequested)))
     {
         // Early return if there's no new data
-        return true;
+        return 0;
     }
     _prevByteBufferSize = byteBufferSize;
     VN_PROFILER_TIME_CURRENT_SCOPE();
-    for (size_t fromHeadIndex = 0; fromHeadIndex < byteBufferSize; ++fromHeadIndex)
+    size_t numPacketsDispatched = 0;
+    size_t fromHeadIndex = _findNextSyncByte(0, byteBufferSize);
+    while (fromHeadIndex < byteBufferSize)
     {
-        for (const auto& currentDispatcher : this->_dispatchers)
+        // Where to resume scanning. Bytes before a dispatched packet are discarded with it, so scanning resumes at the new head rather than rescanning.
+        size_t resumeIndex = fromHeadIndex + 1;
+        for (size_t dispatcherIndex = 0; dispatcherIndex < _dispatchers.size(); ++dispatcherIndex)
         {
+            const auto& currentDispatcher = _dispatchers[dispatcherIndex];
             // TODO 133: Modify to handle multi-size sync bytes
-            if (currentDispatcher.syncBytes.front() == _primaryByteBuffer.peek_unchecked(fromHeadIndex))
+            if (currentDispatcher.syncBytes.front() != _primaryByteBuffer.peek_unchecked(fromHeadIndex)) { continue; }
+
+            auto retVal = currentDispatcher.packetDispatcher->findPacket(_primaryByteBuffer, fromHeadIndex);
+            switch (retVal.validity)
             {
-                auto retVal = currentDispatcher.packetDispatcher->findPacket(_primaryByteBuffer, fromHeadIndex);
-                switch (retVal.validity)
+                case (PacketDispatcher::FindPacketRetVal::Validity::Valid):
+                {
+                    _numValidPackets[dispatcherIndex].fetch_add(1, std::memory_order_relaxed);
+                    VN_DEBUG_2("Packet found: " + std::to_string(currentDispatcher.syncBytes.front()) + " length: " + std::to_string(retVal.length));
+                    currentDispatcher.packetDispatcher->dispatchPacket(_primaryByteBuffer, fromHeadIndex);
+
+                    // Require that at least the sync bytes are discarded, to prevent locking due to a bad dispatcher
+                    size_t numPacketBytesToDiscard = std::max(currentDispatcher.syncBytes.size(), retVal.length);
+                    _copyToSkippedByteBufferIfEnabled(fromHeadIndex);
+                    _copyToReceivedByteBufferIfEnabled(fromHeadIndex + numPacketBytesToDiscard);
+                    _primaryByteBuffer.discard(fromHeadIndex + numPacketBytesToDiscard);
+
+                    _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Valid;
+                    _prevByteBufferSize -= fromHeadIndex + numPacketBytesToDiscard;
+                    byteBufferSize -= fromHeadIndex + numPacketBytesToDiscard;
+
+                    // When dispatching one packet at a time we return here so that callers can pull data off the serial queue between packets.
+                    if (++numPacketsDispatched >= maxNumPackets) { return numPacketsDispatched; }
+                    resumeIndex = 0;
+                    break;
+                }
+                case (PacketDispatcher::FindPacketRetVal::Validity::Invalid):
+                {
+                    // Keep searching, might have just been a random sync byte.
+                    _numInvalidPackets[dispatcherIndex].fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                case (PacketDispatcher::FindPacketRetVal::Validity::Incomplete):
                 {
-                    case (PacketDispatcher::FindPacketRetVal::Validity::Valid):
-                    {
-                        ++currentDispatcher.numValidPackets;
-                        VN_DEBUG_2("Packet found: " + std::to_string(currentDispatcher.syncBytes.front()) + " length: " + std::to_string(retVal.length));
-                        currentDispatcher.packetDispatcher->dispatchPacket(_primaryByteBuffer, fromHeadIndex);
-
-                        // Require that at least the sync bytes are discarded, to prevent locking due to a bad dispatcher
-                        size_t numPacketBytesToDiscard = std::max(currentDispatcher.syncBytes.size(), retVal.length);
-                        _copyToSkippedByteBufferIfEnabled(fromHeadIndex);
-                        _copyToReceivedByteBufferIfEnabled(fromHeadIndex + numPacketBytesToDiscard);
-                        _primaryByteBuffer.discard(fromHeadIndex + numPacketBytesToDiscard);
-
-                        // We are returning so that we can pull data off the serial queue after each packet. This way we don't blow through the whole buffer
-                        // at a time while the serial queue overflows.
-                        _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Valid;
-                        _prevByteBufferSize -= fromHeadIndex + numPacketBytesToDiscard;
-                        return false;
-                    }
-                    case (PacketDispatcher::FindPacketRetVal::Validity::Invalid):
-                    {
-                        // Keep searching, might have just been a random sync byte.
-                        ++currentDispatcher.numInvalidPackets;
-                        continue;
-                    }
-                    case (PacketDispatcher::FindPacketRetVal::Validity::Incomplete):
-                    {
-                        // Let's trust that this is probably a packet of this type, so we'll wait for more data and start searching again.
-                        // We might as well discard all of the bytes so far, because clearly no one wanted it.
-                        VN_DEBUG_2("Found possible packet: " + std::to_string(currentDispatcher.syncBytes.front()) +
-                                   " bytes available: " + std::to_string(_primaryByteBuffer.size()));
-
-                        // "About to overrun" is roughly true if the bytes avaialble to this packet dispatcher is within 1 serial push of being full. If that's
-                        // true and the dispatcher is returning "incomplete", it's probably never going to find it's packet and is being too greedy. Instead we
-                        // should continue and let the other dispatchers search for packets.
-                        bool aboutToOverrun = (_primaryByteBuffer.capacity() - (byteBufferSize - fromHeadIndex)) < _nominalSerialPush;
-                        if (aboutToOverrun) { continue; }
-
-                        _copyToSkippedByteBufferIfEnabled(fromHeadIndex);
-                        _copyToReceivedByteBufferIfEnabled(fromHeadIndex);
-                        _primaryByteBuffer.discard(fromHeadIndex);
-                        _prevByteBufferSize -= fromHeadIndex;
-                        _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Incomplete;
-                        _prevBytesRequested = retVal.length;
-                        return true;
-                    }
-                    default:
-                        VN_ABORT();
+                    // Let's trust that this is probably a packet of this type, so we'll wait for more data and start searching again.
+                    // We might as well discard all of the bytes so far, because clearly no one wanted it.
+                    VN_DEBUG_2("Found possible packet: " + std::to_string(currentDispatcher.syncBytes.front()) +
+                               " bytes available: " + std::to_string(_primaryByteBuffer.size()));
+
+                    // "About to overrun" is roughly true if the bytes avaialble to this packet dispatcher is within 1 serial push of being full. If that's
+                    // true and the dispatcher is returning "incomplete", it's probably never going to find it's packet and is being too greedy. Instead we
+                    // should continue and let the other dispatchers search for packets.
+                    bool aboutToOverrun = (_primaryByteBuffer.capacity() - (byteBufferSize - fromHeadIndex)) < _nominalSerialPush;
+                    if (aboutToOverrun) { continue; }
+
+                    _copyToSkippedByteBufferIfEnabled(fromHeadIndex);
+                    _copyToReceivedByteBufferIfEnabled(fromHeadIndex);
+                    _primaryByteBuffer.discard(fromHeadIndex);
+                    _prevByteBufferSize -= fromHeadIndex;
+                    _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Incomplete;
+                    _prevBytesRequested = retVal.length;
+                    return numPacketsDispatched;
                 }
+                default:
+                    VN_ABORT();
             }
+            break;  // A packet was dispatched
         }
+        fromHeadIndex = _findNextSyncByte(resumeIndex, byteBufferSize);
     }
     // At this point, we can flush the buffer, because no one is interested in any of the data.
     _copyToSkippedByteBufferIfEnabled(byteBufferSize);
@@ -110,27 +146,106 @@ bool PacketSynchronizer::dispatchNextPacket() noexcept
     _primaryByteBuffer.discard(byteBufferSize);
     _prevByteBufferSize -= byteBufferSize;
     _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Invalid;
-    return true;
+    return numPacketsDispatched;
+}
+
+size_t PacketSynchronizer::_findNextSyncByte(size_t fromHeadIndex, const size_t byteBufferSize) const noexcept
+{
+    // The ring holds at most two linear segments: from the head to the end of the storage, then from the start of the storage.
+    const size_t firstSegmentLength = std::min(_primaryByteBuffer.numLinearBytes(0), byteBufferSize);
+    while (fromHeadIndex < byteBufferSize)
+    {
+        const bool inFirstSegment = fromHeadIndex < firstSegmentLength;
+        const uint8_t* segmentBegin = inFirstSegment ? _primaryByteBuffer.head() + fromHeadIndex : _primaryByteBuffer.data() + (fromHeadIndex - firstSegmentLength);
+        const size_t segmentLength = (inFirstSegment ? firstSegmentLength : byteBufferSize) - fromHeadIndex;
+
+        const uint8_t* segmentEnd = segmentBegin + segmentLength;
+        const uint8_t* found = _scanForSyncByte(segmentBegin, segmentEnd);
+        if (found != segmentEnd) { return fromHeadIndex + static_cast<size_t>(found - segmentBegin); }
+        fromHeadIndex += segmentLength;
+    }
+    return byteBufferSize;
+}
+
+const uint8_t* PacketSynchronizer::_scanForSyncByte(const uint8_t* begin, const uint8_t* const end) const noexcept
+{
+    if (_dispatchers.empty()) { return end; }
+    constexpr size_t blockSize = 16;
+#if (VN_SYNC_SCAN_SSE2)
+    __m128i syncVectors[PACKET_PARSER_CAPACITY];
+    for (size_t i = 0; i < PACKET_PARSER_CAPACITY; ++i) { syncVectors[i] = _mm_set1_epi8(static_cast<char>(_syncByteSet[i])); }
+    for (; end - begin >= static_cast<ptrdiff_t>(blockSize); begin += blockSize)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        __m128i matches = _mm_cmpeq_epi8(block, syncVectors[0]);
+        for (size_t i = 1; i < PACKET_PARSER_CAPACITY; ++i) { matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, syncVectors[i])); }
+        const int matchMask = _mm_movemask_epi8(matches);
+        if (matchMask != 0)
+        {
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                if (matchMask & (1 << i)) { return begin + i; }
+            }
+        }
+    }
+#elif (VN_SYNC_SCAN_NEON)
+    uint8x16_t syncVectors[PACKET_PARSER_CAPACITY];
+    for (size_t i = 0; i < PACKET_PARSER_CAPACITY; ++i) { syncVectors[i] = vdupq_n_u8(_syncByteSet[i]); }
+    for (; end - begin >= static_cast<ptrdiff_t>(blockSize); begin += blockSize)
+    {
+        const uint8x16_t block = vld1q_u8(begin);
+        uint8x16_t matches = vceqq_u8(block, syncVectors[0]);
+        for (size_t i = 1; i < PACKET_PARSER_CAPACITY; ++i) { matches = vorrq_u8(matches, vceqq_u8(block, syncVectors[i])); }
+        const uint64x2_t matches64 = vreinterpretq_u64_u8(matches);
+        if ((vgetq_lane_u64(matches64, 0) | vgetq_lane_u64(matches64, 1)) != 0)
+        {
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                if (_isSyncByte[begin[i]]) { return begin + i; }
+            }
+        }
+    }
+#endif
+    // Scalar tail, or the whole segment if no vector instructions are available.
+    for (; begin != end; ++begin)
+    {
+        if (_isSyncByte[*begin]) { return begin; }
+    }
+    return end;
 }
 
 size_t PacketSynchronizer::getValidPacketCount(const SyncBytes& syncBytes) const noexcept
 {
-    for (auto dispatcher : _dispatchers)
+    for (size_t i = 0; i < _dispatchers.size(); ++i)
     {
-        if (syncBytes == dispatcher.syncBytes) { return dispatcher.numValidPackets; }
+        if (syncBytes == _dispatchers[i].syncBytes) { return _numValidPackets[i].load(std::memory_order_relaxed); }
     }
     return 0;
 }
 
 size_t PacketSynchronizer::getInvalidPacketCount(const SyncBytes& syncBytes) const noexcept
 {
-    for (auto dispatcher : _dispatchers)
+    for (size_t i = 0; i < _dispatchers.size(); ++i)
     {
-        if (syncBytes == dispatcher.syncBytes) { return dispatcher.numInvalidPackets; }
+        if (syncBytes == _dispatchers[i].syncBytes) { return _numInvalidPackets[i].load(std::memory_order_relaxed); }
     }
     return 0;
 }
 
+size_t PacketSynchronizer::getValidPacketCount() const noexcept
+{
+    size_t count = 0;
+    for (const auto& numValidPackets : _numValidPackets) { count += numValidPackets.load(std::memory_order_relaxed); }
+    return count;
+}
+
+size_t PacketSynchronizer::getInvalidPacketCount() const noexcept
+{
+    size_t count = 0;
+    for (const auto& numInvalidPackets : _numInvalidPackets) { count += numInvalidPackets.load(std::memory_order_relaxed); }
+    return count;
+}
+
 void PacketSynchronizer::_copyToSkippedByteBufferIfEnabled(const size_t numBytesToCopy) const noexcept
 {
     if (numBytesToCopy == 0) { return; }
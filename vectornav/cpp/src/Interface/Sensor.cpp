@@ -22,6 +22,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
+#include <type_traits>
 #include "Debug.hpp"
 #include "Interface/Sensor.hpp"
 #include "Interface/Command.hpp"
@@ -31,6 +33,43 @@
 namespace VN
 {
 
+namespace
+{
+// The baud rate each port last connected at, shared by every Sensor so that reconnecting tries it first.
+struct PortBaudRate
+{
+    Serial_Base::PortName portName;
+    Sensor::BaudRate baudRate;
+};
+Vector<PortBaudRate, Config::Sensor::autoConnectPortMemoryCapacity> lastBaudRates;
+Mutex lastBaudRatesMutex;
+
+std::optional<Sensor::BaudRate> getLastBaudRate(const Serial_Base::PortName& portName) noexcept
+{
+    LockGuard lock(lastBaudRatesMutex);
+    for (const auto& lastBaudRate : lastBaudRates)
+    {
+        if (lastBaudRate.portName == portName) { return lastBaudRate.baudRate; }
+    }
+    return std::nullopt;
+}
+
+void setLastBaudRate(const Serial_Base::PortName& portName, const Sensor::BaudRate baudRate) noexcept
+{
+    LockGuard lock(lastBaudRatesMutex);
+    for (auto& lastBaudRate : lastBaudRates)
+    {
+        if (lastBaudRate.portName == portName)
+        {
+            lastBaudRate.baudRate = baudRate;
+            return;
+        }
+    }
+    if (lastBaudRates.size() == lastBaudRates.capacity()) { lastBaudRates.erase(lastBaudRates.begin()); }
+    lastBaudRates.push_back(PortBaudRate{portName, baudRate});
+}
+}  // namespace
+
 // ------------------------------------------
 // Constructor and Desctructor
 // ------------------------------------------
@@ -41,6 +80,11 @@ Sensor::Sensor()
     _packetSynchronizer.addDispatcher(&_faPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_asciiPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_fbPacketDispatcher);
+
+    // Stamp packets with when the serial port received them
+    _faPacketDispatcher.setReceivedTimes(&_serial.receivedTimes());
+    _asciiPacketDispatcher.setReceivedTimes(&_serial.receivedTimes());
+    _fbPacketDispatcher.setReceivedTimes(&_serial.receivedTimes());
 }
 
 Sensor::~Sensor()
@@ -61,6 +105,8 @@ Error Sensor::connect(const Serial_Base::PortName& portName, const BaudRate baud
 {
     Error lastError = _serial.open(portName, static_cast<uint32_t>(baudRate));
     if (lastError != Error::None) { return lastError; }
+    clearRegisterCache();  // May not be the same unit
+    _registersWrittenSinceSave = false;
 #if (THREADING_ENABLE)
     _startListening();
 #endif
@@ -74,20 +120,94 @@ Error Sensor::autoConnect(const Serial_Base::PortName& portName) noexcept
         BaudRate::Baud115200, BaudRate::Baud921600, BaudRate::Baud9600,   BaudRate::Baud19200,  BaudRate::Baud38400,
         BaudRate::Baud57600,  BaudRate::Baud128000, BaudRate::Baud230400, BaudRate::Baud460800,
     };
-    Error error = connect(portName, BaudRate::Baud115200);
+    const auto lastBaudRate = getLastBaudRate(portName);
+    Error error = connect(portName, lastBaudRate.value_or(BaudRate::Baud115200));
     if (error != Error::None) { return error; }
+    if (lastBaudRate.has_value() && verifySensorConnectivity()) { return Error::None; }
+
+    // A unit outputting asynchronous messages identifies its baud rate without being probed, which saves a full set of timed out retries at each wrong rate.
     for (const auto activeBaudRate : possibleBaudRates)
     {
         error = changeHostBaudRate(activeBaudRate);
         if (error == Error::UnsupportedBaudRate) { continue; }
         if (error != Error::None) { return error; }
 
-        if (verifySensorConnectivity()) { return Error::None; }
+        if (_hearsUnit(Config::Sensor::autoConnectListenDuration) && verifySensorConnectivity())
+        {
+            setLastBaudRate(portName, activeBaudRate);
+            return Error::None;
+        }
+    }
+
+    // The unit is silent, so probe each rate.
+    for (const auto activeBaudRate : possibleBaudRates)
+    {
+        error = changeHostBaudRate(activeBaudRate);
+        if (error == Error::UnsupportedBaudRate) { continue; }
+        if (error != Error::None) { return error; }
+
+        if (verifySensorConnectivity())
+        {
+            setLastBaudRate(portName, activeBaudRate);
+            return Error::None;
+        }
     }
     disconnect();
     return Error::ResponseTimeout;
 }
 
+bool Sensor::_hearsUnit(const Microseconds listenDuration) noexcept
+{
+    // At a wrong baud rate, the odd packet may pass its checksum by chance, but far more fail.
+    const size_t validBefore = _packetSynchronizer.getValidPacketCount();
+    const size_t invalidBefore = _packetSynchronizer.getInvalidPacketCount();
+    const auto hearsUnit = [&]()
+    {
+        const size_t numValid = _packetSynchronizer.getValidPacketCount() - validBefore;
+        const size_t numInvalid = _packetSynchronizer.getInvalidPacketCount() - invalidBefore;
+        return (numValid > 0) && (numValid > numInvalid);
+    };
+    Timer timer(listenDuration);
+    timer.start();
+    while (!timer.hasTimedOut())
+    {
+#if (THREADING_ENABLE)
+        thisThread::sleepFor(Config::Sensor::listenSleepDuration);
+#else
+        bool needsMoreData = processNextPacket();
+        if (needsMoreData)
+        {
+            thisThread::sleepFor(Config::Sensor::listenSleepDuration);
+            Error lastError = loadMainBufferFromSerial();
+            if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
+        }
+#endif
+        if (hearsUnit()) { return true; }
+    }
+    return false;
+}
+
+bool Sensor::_awaitStartup(const Microseconds maxDuration) noexcept
+{
+    // Polling a unit that is still booting only times out, so back off between polls. A valid packet cuts the wait short, as the unit is then up.
+    const time_point deadline = now() + maxDuration;
+    Microseconds pollInterval = Config::Sensor::startupPollInitialInterval;
+    while (now() < deadline)
+    {
+        _hearsUnit(std::min(pollInterval, std::chrono::duration_cast<Microseconds>(deadline - now())));
+        const Microseconds remaining = std::chrono::duration_cast<Microseconds>(deadline - now());
+        if (remaining <= Microseconds(0)) { break; }
+        // The poll's timeout is bounded by the time remaining, so that maxDuration holds as an upper bound
+        Registers::System::Model modelRegister;
+        modelRegister.model = "";
+        Command readCommand = modelRegister.toReadCommand();
+        const Error pollError = sendCommand(&readCommand, SendCommandBlockMode::Block, std::min(Config::Sensor::commandSendTimeoutLength, remaining));
+        if ((pollError == Error::None) && !modelRegister.fromCommand(readCommand) && (modelRegister.model != "")) { return true; }
+        pollInterval = std::min(pollInterval * 2, Config::Sensor::startupPollMaxInterval);
+    }
+    return false;
+}
+
 bool Sensor::verifySensorConnectivity() CONST_IF_THREADED noexcept
 {
     if constexpr (Config::CommandProcessor::commandProcQueueCapacity == 0) { return false; }
@@ -126,6 +246,10 @@ Error Sensor::changeHostBaudRate(const BaudRate newBaudRate) noexcept
     if (lastError != Error::None) { return lastError; }
 #if (THREADING_ENABLE)
     _startListening();
+#else
+    // Bytes received at the old baud rate can never complete a packet
+    _mainByteBuffer.reset();
+    _packetSynchronizer.reset();
 #endif
     return Error::None;
 }
@@ -136,101 +260,86 @@ void Sensor::disconnect() noexcept
     _stopListening();
 #endif
     _serial.close();
+    _commandProcessor.cancelAllCommands();  // Nothing is left to answer or time them out
 }
 
+#if (THREADING_ENABLE)
+Error Sensor::setListeningThreadAttributes(const ThreadAttributes& attributes) noexcept
+{
+    _listeningThreadAttributes = attributes;
+    if (!_listening) { return Error::None; }
+    _listeningThreadAttributesError = _listeningThread->setAttributes(attributes);
+    return _listeningThreadAttributesError;
+}
+#endif
+
 // ----------------------
 // Accessing Measurements
 // ----------------------
 
-Sensor::CompositeDataQueueReturn Sensor::getNextMeasurement(const bool block) noexcept
+Sensor::CompositeDataQueueReturn Sensor::getNextMeasurement(const bool block, const Microseconds timeout) noexcept
 {
     if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity == 0) { return nullptr; }
-    Timer timer(Config::Sensor::getMeasurementTimeoutLength);
-    timer.start();
     CompositeDataQueueReturn queueReturn = _measurementQueue.get();
     if (!queueReturn)
     {
-        if (block) { queueReturn = _blockOnMeasurement(timer, Config::Sensor::getMeasurementSleepDuration); }
+        if (block) { queueReturn = _blockOnMeasurement(timeout); }
     }
     return queueReturn;
 }
 
-Sensor::CompositeDataQueueReturn Sensor::getMostRecentMeasurement(const bool block) noexcept
+Sensor::CompositeDataQueueReturn Sensor::getMostRecentMeasurement(const bool block, const Microseconds timeout) noexcept
 {
-    Timer timer(Config::Sensor::getMeasurementTimeoutLength);
-    timer.start();
     CompositeDataQueueReturn queueReturn = _measurementQueue.getBack();
     if (!queueReturn)
     {
-        if (block) { queueReturn = _blockOnMeasurement(timer, Config::Sensor::getMeasurementSleepDuration); }
+        if (block) { queueReturn = _blockOnMeasurement(timeout); }
     }
     return queueReturn;
 }
 
-Sensor::CompositeDataQueueReturn Sensor::_blockOnMeasurement(Timer& timer, [[maybe_unused]] const Microseconds sleepLength) CONST_IF_THREADED noexcept
+uint16_t Sensor::getMeasurements(MeasurementData* measurements, const uint16_t maxCount, const Microseconds timeout) noexcept
 {
+    if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity == 0) { return 0; }
+    if (maxCount == 0) { return 0; }
+    uint16_t count = _measurementQueue.getMany(measurements, maxCount);
+    if ((count == 0) && (timeout > Microseconds::zero()))
+    {
+        // Wait for the first, then take whatever else arrived alongside it.
+        CompositeDataQueueReturn first = _blockOnMeasurement(timeout);
+        if (!first) { return 0; }
+        measurements[0] = std::move(*first);
+        first = nullptr;
+        count = 1 + _measurementQueue.getMany(measurements + 1, maxCount - 1);
+    }
+    return count;
+}
+
+Sensor::CompositeDataQueueReturn Sensor::_blockOnMeasurement(const Microseconds timeout) CONST_IF_THREADED noexcept
+{
+#if (THREADING_ENABLE)
+    // The listening thread wakes us as soon as it queues a measurement.
+    return _measurementQueue.get(timeout);
+#else
+    Timer timer(timeout);
+    timer.start();
     bool hasTimedOut = false;
     bool retValHasValue = false;
     CompositeDataQueueReturn queueReturn;
     while (!retValHasValue && !hasTimedOut)
     {
-#if (THREADING_ENABLE)
-        thisThread::sleepFor(sleepLength);
-#else
         bool needsMoreData = processNextPacket();
         if (needsMoreData)
         {
             Error lastError = loadMainBufferFromSerial();
             if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
         }
-#endif
         queueReturn = _measurementQueue.get();
         retValHasValue = queueReturn != nullptr;
         hasTimedOut = timer.hasTimedOut();
     }
     return queueReturn;
-}
-
-Error Sensor::_blockOnCommand(Command* command, Timer& timer) CONST_IF_THREADED noexcept
-{
-    bool hasTimedOut = false;
-#if (!THREADING_ENABLE)
-    Error lastError = loadMainBufferFromSerial();
-    if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
-#endif
-    while (command->isAwaitingResponse())
-    {
-#if (THREADING_ENABLE)
-        thisThread::sleepFor(Config::Sensor::commandSendSleepDuration);
-#else
-        bool needsMoreData = processNextPacket();
-        if (needsMoreData)
-        {
-            thisThread::sleepFor(Config::Sensor::commandSendSleepDuration);
-            lastError = loadMainBufferFromSerial();
-            if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
-        }
 #endif
-        hasTimedOut = timer.hasTimedOut();
-        if (hasTimedOut)
-        {
-            _commandProcessor.popCommandFromQueueBack();   // Since we're not tracking the command, let's remove it from the queue so that we can resend it
-            command->matchResponse("FAIL", time_point());  // Ensure awaiting flag is set false
-            VN_DEBUG_1("Command timed out.");
-            return Error::ResponseTimeout;
-        }
-    };
-
-    if (!command->hasValidResponse())
-    {
-        // The command was popped by another command's response
-        VN_DEBUG_1("Command removed from queue.");
-        return Error::ResponseTimeout;
-    }
-
-    auto maybeError = command->getError();
-    if (maybeError.has_value()) { return maybeError.value(); }
-    return Error::None;
 }
 
 // ----------------
@@ -248,6 +357,7 @@ Error Sensor::readRegister(Register* registerToRead, const bool retryOnFailure)
     if (sendCommandError != Error::None) { return sendCommandError; }
 
     if (registerToRead->fromCommand(readCommand)) { return Error::ReceivedInvalidResponse; }
+    _registerRead(registerToRead);
     return Error::None;
 }
 
@@ -258,17 +368,262 @@ Error Sensor::writeRegister(ConfigurationRegister* registerToWrite, const bool r
     SendCommandBlockMode waitMode;
     if (retryOnFailure) { waitMode = SendCommandBlockMode::BlockWithRetry; }
     else { waitMode = SendCommandBlockMode::Block; }
-    const Error sendCommandError = sendCommand(&writeCommand, waitMode);
-    if (sendCommandError != Error::None) { return sendCommandError; }
-    if (registerToWrite->fromCommand(writeCommand)) { return Error::ReceivedInvalidResponse; };
+    Error error = sendCommand(&writeCommand, waitMode);
+    if ((error == Error::None) && registerToWrite->fromCommand(writeCommand)) { error = Error::ReceivedInvalidResponse; }
+    _registerWritten(registerToWrite, error);
+    return error;
+}
+
+Error Sensor::readRegisters(Register* const* registersToRead, const size_t count, const bool retryOnFailure, Error* errors) CONST_IF_THREADED noexcept
+{
+    return _pipelineRegisterCommands(registersToRead, count, &Register::toReadCommand, retryOnFailure, errors);
+}
+
+Error Sensor::writeRegisters(ConfigurationRegister* const* registersToWrite, const size_t count, const bool retryOnFailure,
+                             Error* errors) CONST_IF_THREADED noexcept
+{
+    return _pipelineRegisterCommands(registersToWrite, count, &ConfigurationRegister::toWriteCommand, retryOnFailure, errors);
+}
+
+Error Sensor::writeRegisterIfChanged(ConfigurationRegister* registerToWrite, bool* written) CONST_IF_THREADED noexcept
+{
+    size_t numWritten = 0;
+    const Error error = _applyConfiguration(&registerToWrite, 1, numWritten);
+    if (written != nullptr) { *written = (numWritten > 0); }
+    return error;
+}
+
+Error Sensor::applyConfiguration(ConfigurationRegister* const* registers, const size_t count, const bool saveToFlash) CONST_IF_THREADED noexcept
+{
+    size_t numWritten = 0;
+    const Error error = _applyConfiguration(registers, count, numWritten);
+    if (error != Error::None) { return error; }
+    if (saveToFlash && _registersWrittenSinceSave) { return writeSettings(); }
     return Error::None;
 }
 
+void Sensor::clearRegisterCache() noexcept
+{
+    LockGuard lock(_registerCacheMutex);
+    _registerCache.clear();
+}
+
+Error Sensor::_applyConfiguration(ConfigurationRegister* const* registers, const size_t count, size_t& numWritten) CONST_IF_THREADED noexcept
+{
+    // Diffed a window at a time, so that only a window's worth of desired values is held at once.
+    constexpr size_t chunkCapacity = Config::Sensor::maxCommandsInFlight;
+    Error firstError = Error::None;
+    for (size_t chunkBegin = 0; chunkBegin < count; chunkBegin += chunkCapacity)
+    {
+        ConfigurationRegister* const* chunk = registers + chunkBegin;
+        const size_t chunkCount = std::min(chunkCapacity, count - chunkBegin);
+        std::array<AsciiMessage, chunkCapacity> desired;
+        std::array<bool, chunkCapacity> needsWrite{};
+        std::array<Register*, chunkCapacity> toRead;
+        size_t numToRead = 0;
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            desired[i] = chunk[i]->toString();
+            const auto cached = _cachedRegisterValue(chunk[i]->toReadCommand().getCommandString());
+            if (!cached.has_value()) { toRead[numToRead++] = chunk[i]; }
+            else { needsWrite[i] = !(*cached == desired[i]); }
+        }
+
+        std::array<Error, chunkCapacity> readErrors;
+        readRegisters(toRead.data(), numToRead, true, readErrors.data());
+        for (size_t i = 0, readIndex = 0; readIndex < numToRead; ++i)
+        {
+            if (toRead[readIndex] != chunk[i]) { continue; }
+            if (readErrors[readIndex++] == Error::None) { needsWrite[i] = !(chunk[i]->toString() == desired[i]); }  // Cached by readRegisters
+            else { needsWrite[i] = true; }  // Write regardless, which reports any error.
+            // Reading overwrote the object, so restore the value to write. The object otherwise keeps the unit's value, formatted as toString would write it.
+            chunk[i]->fromString(desired[i]);
+        }
+
+        std::array<ConfigurationRegister*, chunkCapacity> toWrite;
+        size_t numToWrite = 0;
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            if (needsWrite[i]) { toWrite[numToWrite++] = chunk[i]; }
+        }
+        const Error writeError = writeRegisters(toWrite.data(), numToWrite);
+        numWritten += numToWrite;
+        if (firstError == Error::None) { firstError = writeError; }
+    }
+    return firstError;
+}
+
+template <class RegisterType>
+Error Sensor::_pipelineRegisterCommands(RegisterType* const* registers, const size_t count, Command (RegisterType::*toCommand)(), const bool retryOnFailure,
+                                        Error* errors) CONST_IF_THREADED noexcept
+{
+    if constexpr (Config::CommandProcessor::commandProcQueueCapacity == 0) { return Error::CommandQueueFull; }
+    struct PipelinedCommand
+    {
+        Command command;
+        size_t index = 0;
+        bool inFlight = false;
+        bool confirming = false;
+#if (THREADING_ENABLE)
+        std::future<Error> result;
+#else
+        bool completed = false;
+        Error error = Error::None;
+#endif
+    };
+    std::array<PipelinedCommand, Config::Sensor::maxCommandsInFlight> window{};
+    uint8_t numInFlight = 0;
+    size_t nextToSend = 0;
+    size_t firstFailed = count;
+    Error firstError = Error::None;
+
+    const SendCommandBlockMode waitMode = retryOnFailure ? SendCommandBlockMode::BlockWithRetry : SendCommandBlockMode::Block;
+#if (THREADING_ENABLE)
+    const uint8_t attempts = 1 + (retryOnFailure ? Config::Sensor::commandSendRetriesAllowed : 0);
+    const Microseconds longestWait = Config::Sensor::commandSendTimeoutLength * attempts + Config::Sensor::listenWaitTimeoutLength;
+#endif
+
+    const auto record = [&](const size_t index, const Error error)
+    {
+        // Only writeRegisters pipelines configuration registers.
+        if constexpr (std::is_same_v<RegisterType, ConfigurationRegister>) { _registerWritten(registers[index], error); }
+        else if (error == Error::None) { _registerRead(registers[index]); }
+        if (errors != nullptr) { errors[index] = error; }
+        if ((error != Error::None) && (index < firstFailed))
+        {
+            firstFailed = index;
+            firstError = error;
+        }
+    };
+    const auto finish = [&](PipelinedCommand& pipelined, Error error, const bool sentAlone)
+    {
+        pipelined.inFlight = false;
+        --numInFlight;
+        // A synchronous VNERR does not name its register and is matched to the oldest command, so if a response was lost it may be blamed on the wrong
+        // command. Confirm such failures by resending the command alone.
+        if ((error != Error::None) && (error != Error::ResponseTimeout) && !sentAlone)
+        {
+            pipelined.confirming = true;
+            return;
+        }
+        if ((error == Error::None) && registers[pipelined.index]->fromCommand(pipelined.command)) { error = Error::ReceivedInvalidResponse; }
+        record(pipelined.index, error);
+    };
+    const auto isConfirming = [&window]()
+    {
+        for (const auto& pipelined : window)
+        {
+            if (pipelined.confirming) { return true; }
+        }
+        return false;
+    };
+    const auto isInFlight = [&](const uint8_t registerId)
+    {
+        for (const auto& pipelined : window)
+        {
+            if (pipelined.inFlight && (registers[pipelined.index]->id() == registerId)) { return true; }
+        }
+        return false;
+    };
+
+    while ((nextToSend < count) || (numInFlight > 0))
+    {
+        // A second command for a register already in flight would have the same response, so it waits for the first to complete.
+        while ((nextToSend < count) && (numInFlight < window.size()) && !isInFlight(registers[nextToSend]->id()) && !isConfirming())
+        {
+            PipelinedCommand* pipelined = window.begin();
+            while (pipelined->inFlight) { ++pipelined; }
+            pipelined->command = (registers[nextToSend]->*toCommand)();
+            pipelined->index = nextToSend;
+#if (THREADING_ENABLE)
+            auto promise = std::make_shared<std::promise<Error>>();
+            pipelined->result = promise->get_future();
+            const Error sendError = sendCommandAsync(
+                &pipelined->command, [promise](Command*, const Error error) { promise->set_value(error); }, waitMode);
+#else
+            pipelined->completed = false;
+            const Error sendError = sendCommandAsync(
+                &pipelined->command,
+                [pipelined](Command*, const Error error)
+                {
+                    pipelined->error = error;
+                    pipelined->completed = true;
+                },
+                waitMode);
+#endif
+            if ((sendError == Error::CommandQueueFull) && (numInFlight > 0)) { break; }  // Shared with other commands; resend once one of ours completes
+            ++nextToSend;
+            if (sendError != Error::None)
+            {
+                record(pipelined->index, sendError);
+                continue;
+            }
+            pipelined->inFlight = true;
+            ++numInFlight;
+        }
+        if (numInFlight == 0) { continue; }
+
+#if (THREADING_ENABLE)
+        // Responses arrive in the order commands were sent, so by the time the oldest completes, later ones often have too.
+        PipelinedCommand* oldest = nullptr;
+        for (auto& pipelined : window)
+        {
+            if (pipelined.inFlight && ((oldest == nullptr) || (pipelined.index < oldest->index))) { oldest = &pipelined; }
+        }
+        // As in sendCommand, stop waiting on a stopped listening thread once every attempt would have timed out.
+        while (oldest->result.wait_for(longestWait) != std::future_status::ready) { _commandProcessor.cancelCommand(&oldest->command); }
+        const bool sentAlone = (numInFlight == 1);
+        for (auto& pipelined : window)
+        {
+            if (pipelined.inFlight && (pipelined.result.wait_for(0s) == std::future_status::ready)) { finish(pipelined, pipelined.result.get(), sentAlone); }
+        }
+#else
+        const auto anyCompleted = [&window]()
+        {
+            for (const auto& pipelined : window)
+            {
+                if (pipelined.inFlight && pipelined.completed) { return true; }
+            }
+            return false;
+        };
+        while (!anyCompleted())
+        {
+            bool needsMoreData = processNextPacket();
+            if (needsMoreData)
+            {
+                thisThread::sleepFor(Config::Sensor::commandSendSleepDuration);
+                Error lastError = loadMainBufferFromSerial();
+                if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
+            }
+            _commandProcessor.serviceTimeouts(now());
+        }
+        const bool sentAlone = (numInFlight == 1);
+        for (auto& pipelined : window)
+        {
+            if (pipelined.inFlight && pipelined.completed) { finish(pipelined, pipelined.error, sentAlone); }
+        }
+#endif
+        if (numInFlight > 0) { continue; }
+        for (auto& pipelined : window)
+        {
+            if (!pipelined.confirming) { continue; }
+            pipelined.confirming = false;
+            pipelined.command = (registers[pipelined.index]->*toCommand)();
+            Error error = sendCommand(&pipelined.command, waitMode);
+            if ((error == Error::None) && registers[pipelined.index]->fromCommand(pipelined.command)) { error = Error::ReceivedInvalidResponse; }
+            record(pipelined.index, error);
+        }
+    }
+    return firstError;
+}
+
 Error Sensor::writeSettings() CONST_IF_THREADED noexcept
 {
     if constexpr (Config::CommandProcessor::commandProcQueueCapacity == 0) { return Error::CommandQueueFull; }
     WriteSettings wnv{};
-    return sendCommand(&wnv, SendCommandBlockMode::Block, Config::Sensor::wnvSendTimeoutLength);
+    const Error error = sendCommand(&wnv, SendCommandBlockMode::Block, Config::Sensor::wnvSendTimeoutLength);
+    if (error == Error::None) { _registersWrittenSinceSave = false; }
+    return error;
 }
 
 Error Sensor::reset() CONST_IF_THREADED noexcept
@@ -277,8 +632,9 @@ Error Sensor::reset() CONST_IF_THREADED noexcept
     Reset rst{};
     const Error sendCommandError = sendCommand(&rst, SendCommandBlockMode::BlockWithRetry);
     if (sendCommandError != Error::None) { return sendCommandError; }
-    thisThread::sleepFor(Config::Sensor::resetSleepDuration);  // Give sensor time to start up
-    if (!verifySensorConnectivity())
+    clearRegisterCache();  // The unit reloads its saved settings
+    _registersWrittenSinceSave = false;
+    if (!_awaitStartup(Config::Sensor::resetSleepDuration))
     {
         auto portName = _serial.connectedPortName();
         if (!portName.has_value()) { return Error::UnexpectedSerialError; }
@@ -296,16 +652,17 @@ Error Sensor::restoreFactorySettings() noexcept
 
     Error sendCommandRetVal = sendCommand(&rfs, SendCommandBlockMode::None);
     if (sendCommandRetVal != Error::None) { return sendCommandRetVal; }
+    clearRegisterCache();
+    _registersWrittenSinceSave = false;
 #if (THREADING_ENABLE)
     _stopListening();
 #endif
     const Error changeBaudRateError = _serial.changeBaudRate(115200);
     if (changeBaudRateError != Error::None) { return changeBaudRateError; }
-    thisThread::sleepFor(Config::Sensor::resetSleepDuration);  // Give sensor time to start up
 #if (THREADING_ENABLE)
     _startListening();
 #endif
-    if (!verifySensorConnectivity()) { return Error::ResponseTimeout; }
+    if (!_awaitStartup(Config::Sensor::resetSleepDuration)) { return Error::ResponseTimeout; }
 
     return Error::None;
 }
@@ -358,62 +715,121 @@ Error Sensor::setBootloader(const SetBootLoader::Processor processorId) CONST_IF
     return sendCommand(&sbl, SendCommandBlockMode::Block, 6s);
 }
 
-Error Sensor::sendCommand(Command* commandToSend, SendCommandBlockMode waitMode, const Microseconds waitLengthMs) CONST_IF_THREADED noexcept
+Error Sensor::sendCommand(Command* commandToSend, SendCommandBlockMode waitMode, const Microseconds waitLength) CONST_IF_THREADED noexcept
 {
     if constexpr (Config::CommandProcessor::commandProcQueueCapacity == 0) { return Error::CommandQueueFull; }
-    CommandProcessor::RegisterCommandReturn regCommandReturn = _commandProcessor.registerCommand(commandToSend);
-    if (regCommandReturn.error != CommandProcessor::RegisterCommandReturn::Error::None)
+    if (waitMode == SendCommandBlockMode::None) { return _commandProcessor.sendCommand(commandToSend); }
+#if (THREADING_ENABLE)
+    std::future<Error> result = sendCommandAsync(commandToSend, waitMode, waitLength);
+    // The listening thread completes every command, unless it is stopped first; in that case stop waiting once every attempt would have timed out.
+    const uint8_t attempts = 1 + ((waitMode == SendCommandBlockMode::BlockWithRetry) ? Config::Sensor::commandSendRetriesAllowed : 0);
+    const Microseconds longestWait = waitLength * attempts + Config::Sensor::listenWaitTimeoutLength;
+    while (result.wait_for(longestWait) != std::future_status::ready) { _commandProcessor.cancelCommand(commandToSend); }
+    return result.get();
+#else
+    bool completed = false;
+    Error result = Error::None;
+    const Error sendError = sendCommandAsync(
+        commandToSend,
+        [&completed, &result](Command*, const Error error)
+        {
+            result = error;
+            completed = true;
+        },
+        waitMode, waitLength);
+    if (sendError != Error::None) { return sendError; }
+    while (!completed)
     {
-        if (regCommandReturn.error == CommandProcessor::RegisterCommandReturn::Error::CommandQueueFull) { return Error::CommandQueueFull; }
-        else if (regCommandReturn.error == CommandProcessor::RegisterCommandReturn::Error::CommandResent) { return Error::CommandResent; }
-        else { VN_ABORT(); }
+        bool needsMoreData = processNextPacket();
+        if (needsMoreData)
+        {
+            thisThread::sleepFor(Config::Sensor::commandSendSleepDuration);
+            Error lastError = loadMainBufferFromSerial();
+            if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
+        }
+        _commandProcessor.serviceTimeouts(now());
     }
-    Error lastError = _serial.send(regCommandReturn.message);
-    if (lastError != Error::None) { return lastError; }
-
-    if (waitMode == SendCommandBlockMode::None) { return Error::None; }
-    Timer timer(waitLengthMs);
-    timer.start();
+    return result;
+#endif
+}
 
-    lastError = _blockOnCommand(commandToSend, timer);
-    // We are attempting to try catch ResponseTimeout only
-    if ((lastError == Error::None) || (lastError != Error::ResponseTimeout) || (waitMode != SendCommandBlockMode::BlockWithRetry)) { return lastError; }
+Error Sensor::sendCommandAsync(Command* commandToSend, CommandCompletion onComplete, SendCommandBlockMode waitMode, const Microseconds waitLength) noexcept
+{
+    if constexpr (Config::CommandProcessor::commandProcQueueCapacity == 0) { return Error::CommandQueueFull; }
+    const uint8_t retriesAllowed = (waitMode == SendCommandBlockMode::BlockWithRetry) ? Config::Sensor::commandSendRetriesAllowed : 0;
+    return _commandProcessor.sendCommandAsync(commandToSend, std::move(onComplete), waitLength, retriesAllowed);
+}
 
-    uint8_t retries = 0;  // Has already tried once
-    while (!commandToSend->hasValidResponse())
-    {  // Don't need timeout checked because it will error inside block
-        timer.start();
-        // We can resend because the command string will not have been overwriten by the response
-        regCommandReturn = _commandProcessor.registerCommand(commandToSend);
+#if (THREADING_ENABLE)
+std::future<Error> Sensor::sendCommandAsync(Command* commandToSend, SendCommandBlockMode waitMode, const Microseconds waitLength) noexcept
+{
+    // Shared, as the completion must be copyable and may outlive this call.
+    auto promise = std::make_shared<std::promise<Error>>();
+    std::future<Error> result = promise->get_future();
+    const Error sendError = sendCommandAsync(
+        commandToSend, [promise](Command*, const Error error) { promise->set_value(error); }, waitMode, waitLength);
+    if (sendError != Error::None) { promise->set_value(sendError); }
+    return result;
+}
+#endif
 
-        if (regCommandReturn.error != CommandProcessor::RegisterCommandReturn::Error::None)
-        {
-            if (regCommandReturn.error == CommandProcessor::RegisterCommandReturn::Error::CommandQueueFull) { return Error::CommandQueueFull; }
-            else if (regCommandReturn.error == CommandProcessor::RegisterCommandReturn::Error::CommandResent) { return Error::CommandResent; }
-            else { VN_ABORT(); }
-        }
+Error Sensor::serialSend(const AsciiMessage& msgToSend) noexcept
+{
+    Error lastError = _serial.send(msgToSend);
+    if (lastError != Error::None) { return lastError; }
+    return Error::None;
+}
 
-        lastError = _serial.send(regCommandReturn.message);
-        if (lastError != Error::None) { return lastError; }
+std::optional<AsciiMessage> Sensor::_cachedRegisterValue(const AsciiMessage& address) const noexcept
+{
+    LockGuard lock(_registerCacheMutex);
+    for (const auto& cached : _registerCache)
+    {
+        if (cached.address == address) { return cached.value; }
+    }
+    return std::nullopt;
+}
 
-        lastError = _blockOnCommand(commandToSend, timer);
-        if (lastError != Error::None)
+void Sensor::_cacheRegisterValue(const AsciiMessage& address, const AsciiMessage& value) noexcept
+{
+    LockGuard lock(_registerCacheMutex);
+    for (auto& cached : _registerCache)
+    {
+        if (cached.address == address)
         {
-            if (lastError != Error::ResponseTimeout) { return lastError; }
-            if (++retries == Config::Sensor::commandSendRetriesAllowed)
-            {  // We have run out of retries
-                return Error::ResponseTimeout;
-            }
+            cached.value = value;
+            return;
         }
     }
-    return Error::None;
+    if (_registerCache.size() == _registerCache.capacity()) { _registerCache.erase(_registerCache.begin()); }  // Forget the longest held
+    _registerCache.push_back(CachedRegister{address, value});
 }
 
-Error Sensor::serialSend(const AsciiMessage& msgToSend) noexcept
+void Sensor::_registerRead(Register* registerRead) noexcept
 {
-    Error lastError = _serial.send(msgToSend);
-    if (lastError != Error::None) { return lastError; }
-    return Error::None;
+    ConfigurationRegister* configurationRegister = registerRead->asConfigurationRegister();
+    if (configurationRegister == nullptr) { return; }  // Measurements change on their own, so are not worth holding
+    _cacheRegisterValue(configurationRegister->toReadCommand().getCommandString(), configurationRegister->toString());
+}
+
+void Sensor::_registerWritten(ConfigurationRegister* registerWritten, const Error error) noexcept
+{
+    _registersWrittenSinceSave = true;  // Even a failed write may have reached the unit
+    const AsciiMessage address = registerWritten->toReadCommand().getCommandString();
+    if (error == Error::None)
+    {
+        _cacheRegisterValue(address, registerWritten->toString());
+        return;
+    }
+    LockGuard lock(_registerCacheMutex);
+    for (auto cached = _registerCache.begin(); cached != _registerCache.end(); ++cached)
+    {
+        if (cached->address == address)
+        {
+            _registerCache.erase(cached);
+            break;
+        }
+    }
 }
 
 // ------------------
@@ -463,6 +879,51 @@ void Sensor::unsubscribeFromMessage(PacketQueue_Interface* queueToUnsubscribe, c
     _asciiPacketDispatcher.removeSubscriber(queueToUnsubscribe, filter);
 }
 
+Error Sensor::registerMeasurementCallback(const BinaryOutputMeasurements& binaryOutputMeasurementFilter, MeasurementCallback callback,
+                                          const FaSubscriberFilterType filterType) noexcept
+{
+    const bool failed =
+        _faPacketDispatcher.addMeasurementCallback(std::move(callback), binaryOutputMeasurementFilter.toBinaryHeader().toMeasurementHeader(), filterType);
+    return failed ? Error::MessageSubscriberCapacityReached : Error::None;
+}
+
+Error Sensor::registerMeasurementCallback(const AsciiHeader& asciiHeaderFilter, MeasurementCallback callback, const AsciiSubscriberFilterType filterType) noexcept
+{
+    const bool failed = _asciiPacketDispatcher.addMeasurementCallback(std::move(callback), asciiHeaderFilter, filterType);
+    return failed ? Error::MessageSubscriberCapacityReached : Error::None;
+}
+
+void Sensor::deregisterMeasurementCallbacks(const SyncByte syncByte) noexcept
+{
+    switch (syncByte)
+    {
+        case (SyncByte::Ascii):
+        {
+            _asciiPacketDispatcher.removeMeasurementCallbacks();
+            break;
+        }
+        case (SyncByte::FA):
+        {
+            _faPacketDispatcher.removeMeasurementCallbacks();
+            break;
+        }
+        default:
+            VN_ABORT();
+    }
+}
+
+void Sensor::deregisterMeasurementCallbacks(const BinaryOutputMeasurements& filter) noexcept
+{
+    _faPacketDispatcher.removeMeasurementCallbacks(filter.toBinaryHeader().toMeasurementHeader());
+}
+
+void Sensor::deregisterMeasurementCallbacks(const AsciiHeader& filter) noexcept { _asciiPacketDispatcher.removeMeasurementCallbacks(filter); }
+
+void Sensor::setMeasurementsToParse(const BinaryOutputMeasurements& measurementsToParse) noexcept
+{
+    _faPacketDispatcher.setMeasurementsToParse(measurementsToParse.toBinaryHeader().toMeasurementHeader());
+}
+
 // ----------------------------
 // Unthreaded Packet Processing
 // ----------------------------
@@ -471,34 +932,63 @@ Error Sensor::loadMainBufferFromSerial() noexcept { return _serial.getData(); }
 
 bool Sensor::processNextPacket() noexcept { return _packetSynchronizer.dispatchNextPacket(); }
 
+size_t Sensor::processAllPackets() noexcept
+{
+    const size_t packetsProcessed = _packetSynchronizer.dispatchAllPackets();
+    _commandProcessor.serviceTimeouts(now());
+    return packetsProcessed;
+}
+
 #if (THREADING_ENABLE)
 
 void Sensor::_listen() noexcept
 {
     _mainByteBuffer.reset();
+    _packetSynchronizer.reset();
+    const bool blockingWait = _serial.supportsBlockingWait();
     while (_listening)
     {
+        if (blockingWait)
+        {  // Sleeps until bytes arrive or _stopListening wakes us, rather than polling the port.
+            Error waitError = _serial.waitForData(_listenWaitLength());
+            if (!_listening) { break; }
+            if (waitError != Error::None)
+            {
+                _asyncErrorQueue.put(AsyncError(waitError));
+                thisThread::sleepFor(Config::Sensor::listenSleepDuration);
+            }
+        }
         Error lastError = loadMainBufferFromSerial();
         if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError)); }
-        bool needsMoreData = false;
-        while (!needsMoreData) { needsMoreData = processNextPacket(); }
-        thisThread::sleepFor(Config::Sensor::listenSleepDuration);
+        processAllPackets();
+        if (!blockingWait) { thisThread::sleepFor(Config::Sensor::listenSleepDuration); }
     }
 }
 
+Microseconds Sensor::_listenWaitLength() const noexcept
+{
+    // Wake in time to resend or time out the next pending command.
+    const auto nextTimeout = _commandProcessor.nextTimeout();
+    if (!nextTimeout.has_value()) { return Config::Sensor::listenWaitTimeoutLength; }
+    const Microseconds untilTimeout = std::chrono::ceil<Microseconds>(*nextTimeout - now());
+    return std::clamp(untilTimeout, Microseconds::zero(), Config::Sensor::listenWaitTimeoutLength);
+}
+
 void Sensor::_startListening() noexcept
 {
     if (_listening) { return; }
     _listening = true;
     _listeningThread = std::make_unique<Thread>(&Sensor::_listen, this);
-
-    // _listeningThread->setHighestPriority(); // ** Commented as it is compile erroring or failing in runtime.
+    const Error error = _listeningThread->setAttributes(_listeningThreadAttributes);
+    if ((error != Error::None) && (error != _listeningThreadAttributesError)) { _asyncErrorQueue.put(AsyncError(error)); }
+    _listeningThreadAttributesError = error;
 }
 
 void Sensor::_stopListening() noexcept
 {
     if (!_listening) { return; }
     _listening = false;
+    _serial.interruptWait();
     _listeningThread->join();
 }
 #endif
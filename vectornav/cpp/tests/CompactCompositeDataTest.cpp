@@ -0,0 +1,176 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Checks that a CompactCompositeData packed from a parsed CompositeData holds exactly its fields, reads them back by name, and expands back into an
+// equal CompositeData.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+#include "Interface/CompactCompositeData.hpp"
+
+using namespace VN;
+
+namespace
+{
+
+size_t numFailures = 0;
+
+void expect(const bool condition, const char* description)
+{
+    if (!condition)
+    {
+        std::printf("Failed: %s\n", description);
+        ++numFailures;
+    }
+}
+
+template <class T>
+bool sameField(const std::optional<T>& lhs, const std::optional<T>& rhs)
+{
+    return (lhs.has_value() == rhs.has_value()) && (!lhs.has_value() || (std::memcmp(&*lhs, &*rhs, sizeof(T)) == 0));
+}
+
+/// @brief Counts the populated fields of a CompositeData.
+struct FieldCounter
+{
+    size_t count = 0;
+
+    template <class T>
+    bool extract(const std::optional<T>& member) noexcept
+    {
+        count += member.has_value();
+        return false;
+    }
+};
+
+size_t countFields(const CompositeData& compositeData)
+{
+    FieldCounter counter;
+    for (const uint8_t group : CompactCompositeData::groupIndices)
+    {
+        for (uint8_t field = 0; field < 31; ++field) { compositeData.visitField(counter, group, field); }
+    }
+    return counter.count;
+}
+
+/// @brief Appends an FA packet carrying every fixed-size field of the passed binary groups, to the byte buffer.
+void putPacket(ByteBuffer& byteBuffer, const std::vector<uint8_t>& groups)
+{
+    std::vector<uint8_t> packet{0xFA, 0};
+    size_t payloadLength = 0;
+    for (const uint8_t group : groups)
+    {
+        packet[1] |= static_cast<uint8_t>(1u << group);
+        uint16_t fields = 0;
+        for (uint8_t field = 0; field < 15; ++field)
+        {
+            const auto fieldSize = getStaticBinaryTypeSize(group, field);
+            if (fieldSize.has_value() && (fieldSize.value() > 0))
+            {
+                fields |= static_cast<uint16_t>(1u << field);
+                payloadLength += fieldSize.value();
+            }
+        }
+        packet.push_back(static_cast<uint8_t>(fields & 0xFF));
+        packet.push_back(static_cast<uint8_t>(fields >> 8));
+    }
+    for (size_t i = 0; i < payloadLength; ++i) { packet.push_back(static_cast<uint8_t>(i * 7 + 3)); }
+    const uint16_t crc = CalculateCRC(packet.data() + 1, packet.size() - 1);
+    packet.push_back(static_cast<uint8_t>(crc >> 8));
+    packet.push_back(static_cast<uint8_t>(crc & 0xFF));
+    byteBuffer.put(packet.data(), packet.size());
+}
+
+}  // namespace
+
+int main()
+{
+    // Time and IMU, then time, IMU, attitude and INS, which is more than the field capacity
+    ByteBuffer byteBuffer(4096);
+    putPacket(byteBuffer, {1, 2});
+    const size_t largePacketIndex = byteBuffer.size();
+    putPacket(byteBuffer, {1, 2, 4, 5});
+    const auto found = FaPacketProtocol::findPacket(byteBuffer, 0, nullptr);
+    const auto foundLarge = FaPacketProtocol::findPacket(byteBuffer, largePacketIndex, nullptr);
+    if ((found.validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) || (foundLarge.validity != PacketDispatcher::FindPacketRetVal::Validity::Valid))
+    {
+        std::printf("Failed to find the test packets\n");
+        return 1;
+    }
+
+    CompositeData parsed;
+    expect(!FaPacketProtocol::parsePacket(byteBuffer, 0, found.metadata, Config::PacketDispatchers::cdEnabledMeasTypes, parsed), "parsing the packet");
+    parsed.timestamp = time_point(std::chrono::microseconds(1234));
+
+    const CompactCompositeData compact(parsed);
+    expect(!compact.overflowed(), "the packet fits");
+    expect(compact.size() == countFields(parsed), "every populated field is packed");
+    expect(compact.matchesMessage(found.metadata.header), "the header is kept");
+    expect(compact.timestamp == parsed.timestamp, "the timestamp is kept");
+    expect(compact.has(2, 4) == parsed.imu.accel.has_value(), "presence follows the parsed fields");
+    expect(!compact.has(4, 1) && (compact.presence()[3] == 0), "fields of groups not in the packet are absent");
+
+    expect(sameField(compact.get(&CompositeData::ImuGroup::accel), parsed.imu.accel), "IMU field read by name");
+    expect(sameField(compact.get(&CompositeData::ImuGroup::angularRate), parsed.imu.angularRate), "another IMU field read by name");
+    expect(sameField(compact.get(&CompositeData::TimeGroup::timeGps), parsed.time.timeGps), "time field read by name");
+    expect(!compact.get(&CompositeData::InsGroup::posLla).has_value(), "absent field read by name");
+
+    const CompactCompositeData copy = compact;
+    const CompositeData expanded = copy.toCompositeData();
+    expect(countFields(expanded) == countFields(parsed), "the expansion holds the same fields");
+    expect(sameField(expanded.imu.accel, parsed.imu.accel) && sameField(expanded.imu.angularRate, parsed.imu.angularRate), "IMU fields round trip");
+    expect(sameField(expanded.time.timeStartup, parsed.time.timeStartup) && sameField(expanded.time.timeUtc, parsed.time.timeUtc), "time fields round trip");
+    expect(expanded.matchesMessage(found.metadata.header) && (expanded.timestamp == parsed.timestamp), "header and timestamp round trip");
+
+    // Fields past the capacity are dropped and flagged, rather than written out of bounds
+    CompositeData parsedLarge;
+    FaPacketProtocol::parsePacket(byteBuffer, largePacketIndex, foundLarge.metadata, Config::PacketDispatchers::cdEnabledMeasTypes, parsedLarge);
+    const CompactCompositeData compactLarge(parsedLarge);
+    expect(compactLarge.overflowed() && (compactLarge.size() < countFields(parsedLarge)), "an oversized measurement is flagged");
+    expect(sameField(compactLarge.get(&CompositeData::TimeGroup::timeGps), parsedLarge.time.timeGps), "fields which fit are kept");
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1SATINFO_BIT)
+    // Only the reported satellites are packed
+    CompositeData withSatellites;
+    GnssSatInfo satInfo;
+    satInfo.numSats = 3;
+    for (uint8_t i = 0; i < satInfo.numSats; ++i)
+    {
+        satInfo.svId[i] = i + 10;
+        satInfo.az[i] = static_cast<int16_t>(i * 100 - 50);
+    }
+    withSatellites.gnss.gnss1SatInfo = satInfo;
+    const CompactCompositeData compactSatellites(withSatellites);
+    const auto satInfoBack = compactSatellites.get(&CompositeData::GnssGroup::gnss1SatInfo);
+    expect(satInfoBack.has_value() && (satInfoBack->numSats == 3) && (satInfoBack->svId == satInfo.svId) && (satInfoBack->az == satInfo.az),
+           "satellite info round trips");
+#endif
+
+    std::printf("%zu bytes per CompactCompositeData, %zu per CompositeData\n", sizeof(CompactCompositeData), sizeof(CompositeData));
+    std::printf("%zu failures\n", numFailures);
+    return (numFailures == 0) ? 0 : 1;
+}
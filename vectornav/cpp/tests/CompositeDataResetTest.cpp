@@ -0,0 +1,171 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Checks that a reused CompositeData, such as a measurement queue slot, holds only the fields of the packet last parsed into it, whichever measurements
+// were selected for the packets parsed into it before.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "Implementation/CoreUtils.hpp"
+#include "Implementation/FaPacketProtocol.hpp"
+
+using namespace VN;
+
+namespace
+{
+
+size_t numFailures = 0;
+
+void expect(const bool condition, const char* description)
+{
+    if (!condition)
+    {
+        std::printf("Failed: %s\n", description);
+        ++numFailures;
+    }
+}
+
+template <class T>
+bool sameField(const std::optional<T>& lhs, const std::optional<T>& rhs)
+{
+    return (lhs.has_value() == rhs.has_value()) && (!lhs.has_value() || (std::memcmp(&*lhs, &*rhs, sizeof(T)) == 0));
+}
+
+/// @brief Appends an FA packet carrying every fixed-size field of the passed binary groups, to the byte buffer.
+void putPacket(ByteBuffer& byteBuffer, const std::vector<uint8_t>& groups)
+{
+    std::vector<uint8_t> packet{0xFA, 0};
+    std::vector<uint16_t> fieldWords;
+    size_t payloadLength = 0;
+    for (const uint8_t group : groups)
+    {
+        packet[1] |= static_cast<uint8_t>(1u << group);
+        uint16_t fields = 0;
+        for (uint8_t field = 0; field < 15; ++field)
+        {
+            const auto fieldSize = getStaticBinaryTypeSize(group, field);
+            if (fieldSize.has_value() && (fieldSize.value() > 0))
+            {
+                fields |= static_cast<uint16_t>(1u << field);
+                payloadLength += fieldSize.value();
+            }
+        }
+        packet.push_back(static_cast<uint8_t>(fields & 0xFF));
+        packet.push_back(static_cast<uint8_t>(fields >> 8));
+    }
+    for (size_t i = 0; i < payloadLength; ++i) { packet.push_back(static_cast<uint8_t>(i * 7 + 3)); }
+    const uint16_t crc = CalculateCRC(packet.data() + 1, packet.size() - 1);
+    packet.push_back(static_cast<uint8_t>(crc >> 8));
+    packet.push_back(static_cast<uint8_t>(crc & 0xFF));
+    byteBuffer.put(packet.data(), packet.size());
+}
+
+struct ParsedPacket
+{
+    size_t syncByteIndex;
+    FaPacketProtocol::Metadata metadata;
+    const FaPacketProtocol::HeaderLayout* layout;
+};
+
+bool parse(const ByteBuffer& byteBuffer, const ParsedPacket& packet, const EnabledMeasurements& measurementsToParse, const bool useLayout,
+           CompositeData& compositeData)
+{
+    if (useLayout)
+    {
+        return FaPacketProtocol::parsePacket(byteBuffer, packet.syncByteIndex, packet.metadata, *packet.layout, measurementsToParse, compositeData);
+    }
+    return FaPacketProtocol::parsePacket(byteBuffer, packet.syncByteIndex, packet.metadata, measurementsToParse, compositeData);
+}
+
+}  // namespace
+
+int main()
+{
+    // Time, IMU, attitude and INS, then IMU only
+    ByteBuffer byteBuffer(4096);
+    putPacket(byteBuffer, {1, 2, 4, 5});
+    const size_t secondPacketIndex = byteBuffer.size();
+    putPacket(byteBuffer, {2});
+
+    FaPacketProtocol::HeaderLayoutCache layoutCache;
+    std::vector<ParsedPacket> packets;
+    for (const size_t syncByteIndex : {size_t{0}, secondPacketIndex})
+    {
+        FaPacketProtocol::findPacket(byteBuffer, syncByteIndex, &layoutCache);  // Once to remember the layout, then again to use it
+        const auto found = FaPacketProtocol::findPacket(byteBuffer, syncByteIndex, &layoutCache);
+        if ((found.validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) || (found.layout == nullptr))
+        {
+            std::printf("Failed to find the test packet at %zu\n", syncByteIndex);
+            return 1;
+        }
+        packets.push_back(ParsedPacket{syncByteIndex, found.metadata, found.layout});
+    }
+    const ParsedPacket& fullPacket = packets[0];
+    const ParsedPacket& imuPacket = packets[1];
+
+    const EnabledMeasurements all = Config::PacketDispatchers::cdEnabledMeasTypes;
+    EnabledMeasurements timeAndAttitude{};
+    timeAndAttitude[0] = all[0];
+    timeAndAttitude[3] = all[3];
+    EnabledMeasurements imuOnly{};
+    imuOnly[1] = all[1];
+
+    for (const bool useLayout : {true, false})
+    {
+        CompositeData expectedFull;
+        CompositeData expectedTimeAndAttitude;
+        expect(!parse(byteBuffer, fullPacket, all, useLayout, expectedFull), "parsing every measurement");
+        expect(!parse(byteBuffer, fullPacket, timeAndAttitude, useLayout, expectedTimeAndAttitude), "parsing time and attitude");
+        expect(expectedFull.imu.accel.has_value() && expectedFull.ins.posLla.has_value(), "a full parse populates IMU and INS");
+
+        // A narrower mask after a wider one must not leave the previous packet's fields behind
+        CompositeData slot;
+        parse(byteBuffer, fullPacket, all, useLayout, slot);
+        parse(byteBuffer, fullPacket, timeAndAttitude, useLayout, slot);
+        expect(!slot.imu.accel.has_value() && !slot.imu.angularRate.has_value(), "IMU fields cleared after narrowing the mask");
+        expect(!slot.ins.posLla.has_value() && !slot.ins.velNed.has_value(), "INS fields cleared after narrowing the mask");
+        expect(sameField(slot.time.timeGps, expectedFull.time.timeGps) && sameField(slot.attitude.ypr, expectedFull.attitude.ypr),
+               "selected fields match a full parse");
+
+        // A wider mask after a narrower one, then a different mask on a different header
+        parse(byteBuffer, fullPacket, all, useLayout, slot);
+        expect(sameField(slot.imu.accel, expectedFull.imu.accel) && sameField(slot.ins.posLla, expectedFull.ins.posLla),
+               "fields restored after widening the mask");
+        parse(byteBuffer, fullPacket, timeAndAttitude, useLayout, slot);
+        parse(byteBuffer, imuPacket, imuOnly, useLayout, slot);
+        expect(!slot.time.timeGps.has_value() && !slot.attitude.ypr.has_value(), "time and attitude fields cleared by an IMU-only packet");
+        expect(slot.imu.accel.has_value(), "IMU fields parsed from an IMU-only packet");
+
+        // Back to the full packet with time and attitude, having been reset with the IMU-only mask
+        parse(byteBuffer, fullPacket, timeAndAttitude, useLayout, slot);
+        expect(!slot.imu.accel.has_value(), "IMU fields cleared after switching back");
+        expect(sameField(slot.time.timeGps, expectedTimeAndAttitude.time.timeGps) && sameField(slot.attitude.ypr, expectedTimeAndAttitude.attitude.ypr),
+               "selected fields match after switching back");
+    }
+
+    std::printf("%zu failures\n", numFailures);
+    return (numFailures == 0) ? 0 : 1;
+}
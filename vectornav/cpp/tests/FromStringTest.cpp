@@ -0,0 +1,112 @@
+// The MIT License (MIT)
+// 
+//  VectorNav Software Development Kit (v0.15.1)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Cross-checks StringUtils::fromString, which parses the fixed formats the units output without the general algorithm, against the general parser
+// (std::from_chars where the standard library provides it for floating point) over 12 million strings. Every value must match bit for bit, and both must
+// reject the same strings.
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include "TemplateLibrary/String.hpp"
+
+using namespace VN;
+
+namespace
+{
+
+struct Tally
+{
+    size_t numChecked = 0;
+    size_t numFixedFormat = 0;
+    size_t numMismatched = 0;
+};
+
+template <class T>
+void check(const char* string, Tally& tally)
+{
+    const char* end = string + std::strlen(string);
+    const std::optional<T> value = StringUtils::fromString<T>(string, end);
+    const std::optional<T> expected = StringUtils::fromStringGeneral<T>(string, end);
+    ++tally.numChecked;
+    if (StringUtils::fromStringFixedFormat<T>(string, end).has_value()) { ++tally.numFixedFormat; }
+
+    const bool matches = (value.has_value() == expected.has_value()) && (!value.has_value() || (std::memcmp(&*value, &*expected, sizeof(T)) == 0));
+    if (!matches)
+    {
+        if (tally.numMismatched < 20) { std::printf("Mismatch parsing \"%s\" as %s\n", string, std::is_same<T, float>::value ? "float" : "double"); }
+        ++tally.numMismatched;
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    Tally tally;
+    std::mt19937_64 generator(7);
+    char string[64];
+
+    // The formats measurements and registers are output in, along with general ones, over a range of magnitudes.
+    std::uniform_real_distribution<double> unit(-1, 1);
+    const char* formats[] = {"%+08.3f", "%+07.4f", "%+010.6f", "%+.6E", "%+013.8f", "%+012.6f", "%+09.3f", "%.17g", "%+.9E", "%+021.12f"};
+    const double scales[] = {1, 10, 1000, 1e6, 1e-3, 1e9};
+    for (size_t i = 0; i < 3'000'000; ++i)
+    {
+        std::snprintf(string, sizeof(string), formats[i % std::size(formats)], unit(generator) * scales[(i / std::size(formats)) % std::size(scales)]);
+        check<float>(string, tally);
+        check<double>(string, tally);
+    }
+
+    // Decimals lying exactly halfway between two floats, where narrowing a correctly rounded double would round the wrong way.
+    std::uniform_int_distribution<uint32_t> floatBits(0x30000000, 0x4f000000);
+    for (size_t i = 0; i < 2'000'000; ++i)
+    {
+        const uint32_t bits = floatBits(generator);
+        float below;
+        std::memcpy(&below, &bits, sizeof(below));
+        const double midpoint = (static_cast<double>(below) + static_cast<double>(std::nextafter(below, INFINITY))) / 2;
+        std::snprintf(string, sizeof(string), "%.17g", midpoint);
+        check<float>(string, tally);
+        std::snprintf(string, sizeof(string), "%+.8f", midpoint);
+        check<float>(string, tally);
+        std::snprintf(string, sizeof(string), "%+.6E", midpoint);
+        check<float>(string, tally);
+    }
+
+    // Malformed input and the limits of the fixed-format parser.
+    const char* edgeCases[] = {"+",        "-",    "",       ".",     "+.",    "1.",    "-.5",    "+0",
+                               "-0",       "-0.000", "1e",   "1E+",   "1E+023", "1E-22", "9007199254740993", "9007199254740992",
+                               "12345678901234567890", "1.5e300", "abc", "+1.0x", "00000000000000000000001.5", " 1.0", "1,0", "+1.0E+00"};
+    for (const char* edgeCase : edgeCases)
+    {
+        check<float>(edgeCase, tally);
+        check<double>(edgeCase, tally);
+    }
+
+    std::printf("%zu strings checked, %zu through the fixed-format parser, %zu mismatched\n", tally.numChecked, tally.numFixedFormat, tally.numMismatched);
+    return (tally.numMismatched == 0) ? 0 : 1;
+}
@@ -90,6 +90,7 @@ ext_modules = [
             '../cpp/src/Implementation/FbPacketDispatcher.cpp',
             '../cpp/src/Implementation/FbPacketProtocol.cpp',
             '../cpp/src/Implementation/PacketSynchronizer.cpp',
+            '../cpp/src/Implementation/PacketArena.cpp',
 
             # Interface
             '../cpp/src/Interface/Command.cpp',
@@ -3212,6 +3212,9 @@ namespace VN
 		compositeData.def("matchesMessage", py::overload_cast<const AsciiHeader&>(&CompositeData::matchesMessage, py::const_))
 		.def("matchesMessage", py::overload_cast<const BinaryHeader&>(&CompositeData::matchesMessage, py::const_))
 		.def("matchesMessage", py::overload_cast<const Registers::System::BinaryOutput&>(&CompositeData::matchesMessage, py::const_))
+		.def_property_readonly("timestamp",
+			// Seconds on the same monotonic clock as Python's time.monotonic()
+			[](const CompositeData& self) { return std::chrono::duration<double>(self.timestamp.time_since_epoch()).count(); })
 		.def_readwrite("time", &CompositeData::time)
 		.def_readwrite("imu", &CompositeData::imu)
 		.def_readwrite("gnss", &CompositeData::gnss)
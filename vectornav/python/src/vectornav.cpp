@@ -34,6 +34,7 @@
 #include "Interface/Registers.hpp"
 #include "Interface/Sensor.hpp"
 #include "Interface/CompositeData.hpp"
+#include "Interface/CompactCompositeData.hpp"
 #include "Interface/Command.hpp"
 #include "Implementation/MeasurementDatatypes.hpp"
 #include "Interface/Errors.hpp"
@@ -56,6 +57,17 @@ void init_firmware_updater(py::module& m);
 void init_simple_logger(py::module& m);
 void init_data_export(py::module& m);
 
+// Python always receives a CompositeData, expanded from the MeasurementQueue's CompactCompositeData if it holds them.
+const CompositeData& toPythonMeasurement(const CompositeData& measurement) { return measurement; }
+CompositeData toPythonMeasurement(const CompactCompositeData& measurement) { return measurement.toCompositeData(); }
+std::vector<CompositeData> toPythonMeasurements(std::vector<CompositeData>&& measurements) { return std::move(measurements); }
+std::vector<CompositeData> toPythonMeasurements(std::vector<CompactCompositeData>&& measurements) {
+  std::vector<CompositeData> compositeData;
+  compositeData.reserve(measurements.size());
+  for (const auto& measurement : measurements) { compositeData.push_back(measurement.toCompositeData()); }
+  return compositeData;
+}
+
 std::string genErrorMessage(Error error) {
   return "Error[" + std::to_string(static_cast<uint16_t>(error)) + "]: " + errorCodeToString(error);   
 }
@@ -115,31 +127,51 @@ PYBIND11_MODULE(vectornav, m) {
       }
     )
     .def("disconnect", &Sensor::disconnect)
+    .def("setListeningThreadAttributes",
+      [](Sensor& vs, const ThreadAttributes& attributes) {
+        Error error = vs.setListeningThreadAttributes(attributes);
+        if (error != Error::None) { throw std::runtime_error(genErrorMessage(error)); }
+      }
+    )
     // Measurement Accessor
     .def("hasMeasurement", &Sensor::hasMeasurement)
     .def("getNextMeasurement",
       [](Sensor& vs) -> std::optional<VN::CompositeData> {
         auto ownPtr = vs.getNextMeasurement();
-        if (ownPtr) { return std::make_optional(*ownPtr); } else { return std::nullopt; }      
+        if (ownPtr) { return std::make_optional<VN::CompositeData>(toPythonMeasurement(*ownPtr)); } else { return std::nullopt; }      
       }
     )
     .def("getNextMeasurement",
       [](Sensor& vs, const bool blocking) -> std::optional<VN::CompositeData> {
         auto ownPtr = vs.getNextMeasurement(blocking);
-        if (ownPtr) { return std::make_optional(*ownPtr); } else { return std::nullopt; }      
+        if (ownPtr) { return std::make_optional<VN::CompositeData>(toPythonMeasurement(*ownPtr)); } else { return std::nullopt; }      
       }
     )
     .def("getMostRecentMeasurement",
       [](Sensor& vs) -> std::optional<VN::CompositeData> {
         auto ownPtr = vs.getMostRecentMeasurement();
-        if (ownPtr) { return std::make_optional(*ownPtr); } else { return std::nullopt; }      
+        if (ownPtr) { return std::make_optional<VN::CompositeData>(toPythonMeasurement(*ownPtr)); } else { return std::nullopt; }      
       }
     )
     .def("getMostRecentMeasurement",
       [](Sensor& vs, const bool blocking) -> std::optional<VN::CompositeData> {
         auto ownPtr = vs.getMostRecentMeasurement(blocking);
-        if (ownPtr) { return std::make_optional(*ownPtr); } else { return std::nullopt; }      
-      }
+        if (ownPtr) { return std::make_optional<VN::CompositeData>(toPythonMeasurement(*ownPtr)); } else { return std::nullopt; }      
+      }
+    )
+    .def("getMeasurements",
+      [](Sensor& vs, const uint16_t maxCount, const Microseconds timeout) -> std::vector<VN::CompositeData> {
+        std::vector<VN::MeasurementData> measurements(maxCount);
+        uint16_t count;
+        {
+          // Let other Python threads run while we wait on the sensor.
+          py::gil_scoped_release release;
+          count = vs.getMeasurements(measurements.data(), maxCount, timeout);
+        }
+        measurements.resize(count);
+        return toPythonMeasurements(std::move(measurements));
+      },
+      py::arg("maxCount") = Config::PacketDispatchers::compositeDataQueueCapacity, py::arg("timeout") = Config::Sensor::getMeasurementTimeoutLength
     )
     // Command Sending
     .def("readRegister",
@@ -166,6 +198,36 @@ PYBIND11_MODULE(vectornav, m) {
         if (error != Error::None) { throw std::runtime_error(genErrorMessage(error)); }
       }
     )
+    .def("readRegisters",
+      [](Sensor& vs, std::vector<Register*> registersToRead, const bool retryOnFailure) {
+        Error error = vs.readRegisters(registersToRead.data(), registersToRead.size(), retryOnFailure);
+        if (error != Error::None) { throw std::runtime_error(genErrorMessage(error)); }
+      },
+      py::arg("registersToRead"), py::arg("retryOnFailure") = true
+    )
+    .def("writeRegisters",
+      [](Sensor& vs, std::vector<ConfigurationRegister*> registersToWrite, const bool retryOnFailure) {
+        Error error = vs.writeRegisters(registersToWrite.data(), registersToWrite.size(), retryOnFailure);
+        if (error != Error::None) { throw std::runtime_error(genErrorMessage(error)); }
+      },
+      py::arg("registersToWrite"), py::arg("retryOnFailure") = true
+    )
+    .def("writeRegisterIfChanged",
+      [](Sensor& vs, ConfigurationRegister* registerToWrite) -> bool {
+        bool written = false;
+        Error error = vs.writeRegisterIfChanged(registerToWrite, &written);
+        if (error != Error::None) { throw std::runtime_error(genErrorMessage(error)); }
+        return written;
+      }
+    )
+    .def("applyConfiguration",
+      [](Sensor& vs, std::vector<ConfigurationRegister*> registers, const bool saveToFlash) {
+        Error error = vs.applyConfiguration(registers.data(), registers.size(), saveToFlash);
+        if (error != Error::None) { throw std::runtime_error(genErrorMessage(error)); }
+      },
+      py::arg("registers"), py::arg("saveToFlash") = true
+    )
+    .def("clearRegisterCache", &Sensor::clearRegisterCache)
     .def("writeSettings",
       [](Sensor& vs) {
         Error error = vs.writeSettings();
@@ -271,6 +333,7 @@ PYBIND11_MODULE(vectornav, m) {
         vs.unsubscribeFromMessage(q, b);
       }
     )
+    .def("setMeasurementsToParse", &Sensor::setMeasurementsToParse)
     // Error Handling
     .def("getAsynchronousError", &Sensor::getAsynchronousError)
     .def("__enter__", [](Sensor& vs) {
@@ -299,6 +362,22 @@ PYBIND11_MODULE(vectornav, m) {
 		.value("Baud460800", Sensor::BaudRate::Baud460800)
 		.value("Baud921600", Sensor::BaudRate::Baud921600);
 
+  py::class_<ThreadAttributes> threadAttributes(m, "ThreadAttributes");
+  threadAttributes
+    .def(py::init<>())
+    .def_readwrite("policy", &ThreadAttributes::policy)
+    .def_readwrite("priority", &ThreadAttributes::priority)
+    .def_readwrite("cpuAffinityMask", &ThreadAttributes::cpuAffinityMask)
+    .def_property("name",
+      [](ThreadAttributes& self) -> std::string { return self.name.c_str(); },
+      [](ThreadAttributes& self, const std::string& value) { self.name = value; }
+    );
+
+  py::enum_<ThreadAttributes::SchedulingPolicy>(threadAttributes, "SchedulingPolicy")
+    .value("Default", ThreadAttributes::SchedulingPolicy::Default)
+    .value("Fifo", ThreadAttributes::SchedulingPolicy::Fifo)
+    .value("RoundRobin", ThreadAttributes::SchedulingPolicy::RoundRobin);
+
   py::enum_<Sensor::SendCommandBlockMode>(sensor, "SendCommandBlockMode")
     .value("none", Sensor::SendCommandBlockMode::None)
     .value("Block", Sensor::SendCommandBlockMode::Block)
@@ -590,6 +669,10 @@ PYBIND11_MODULE(vectornav, m) {
     .value("SerialReadFailed", Error::SerialReadFailed)
     .value("SerialWriteFailed", Error::SerialWriteFailed)
     .value("UnexpectedSerialError", Error::UnexpectedSerialError)
+    .value("ThreadNotRunning", Error::ThreadNotRunning)
+    .value("ThreadPermissionDenied", Error::ThreadPermissionDenied)
+    .value("InvalidThreadAttributes", Error::InvalidThreadAttributes)
+    .value("UnsupportedThreadAttributes", Error::UnsupportedThreadAttributes)
     .value("MeasurementQueueFull", Error::MeasurementQueueFull)
     .value("PrimaryBufferFull", Error::PrimaryBufferFull)
     .value("MessageSubscriberCapacityReached", Error::MessageSubscriberCapacityReached)